@@ -1,46 +1,82 @@
 #include <Arduino.h>
 
+#include "src/App.h"
+#include "src/CollisionBenchmark.h"
 #include "src/Controller.h"
 #include "src/Game.h"
+#include "src/LatencyProbe.h"
+#include "src/PackingBenchmark.h"
+#include "src/Profiler.h"
+#include "src/Scheduler.h"
 
 Game game;
 Display display;
 Controller controller;
+Scheduler scheduler;
+App app(game);
 
 extern HardwareSerial Serial;
 
+/**
+ * @brief Hands all pending key presses to the front end.
+ */
+void inputTask() {
+  PROFILE_SCOPE(PROFILE_INPUT);
+
+  char key;
+
+  while ((key = controller.handleKeyPress()) != NO_KEY) {
+    app.handleKey(key);
+  }
+}
+
+/**
+ * @brief Advances the game by one logic tick.
+ */
+void logicTask() { app.tick(); }
+
+/**
+ * @brief Steps the sound effects.
+ */
+void audioTask() { app.updateSounds(); }
+
+/**
+ * @brief Keeps the background music playing.
+ */
+void playerTask() { app.pollPlayer(); }
+
+/**
+ * @brief Draws and presents a frame.
+ */
+void renderTask() {
+  Display::beginFrame();
+  app.render();
+  Display::endFrame();
+}
+
 void setup() {
   Serial.begin(9600);
 
+#if PACKING_BENCHMARK
+  runPackingBenchmark();
+#endif
+
+#if COLLISION_BENCHMARK
+  runCollisionBenchmark();
+#endif
+
   controller.init();
   display.initDisplay();
+  LATENCY_PROBE_BEGIN();
+  game.begin();
 
-  while (true) {
-    char key = controller.handleKeyPress();
-    if (key == 'A') {
-      break;
-    }
-    delay(100);
-  }
-
-  game.init();
+  // Tasks run in this order when due at the same time. Only the logic tick
+  // catches up on missed slots, so gravity keeps its pace after a stall.
+  scheduler.addTask(F("input"), inputTask, INPUT_PERIOD);
+  scheduler.addTask(F("logic"), logicTask, GAME_TICK, true);
+  scheduler.addTask(F("audio"), audioTask, SOUND_PERIOD);
+  scheduler.addTask(F("player"), playerTask, PLAYER_POLL_PERIOD);
+  scheduler.addTask(F("render"), renderTask, FRAME_INTERVAL);
 }
 
-void loop() {
-  if (game.isGameOver()) {
-    while (true) {
-      char key = controller.handleKeyPress();
-      if (key == 'C') {
-        game.resetGame();
-        game.init();
-        break;
-      }
-    }
-  } else {
-    char key = controller.handleKeyPress();
-    if (key != NO_KEY) {
-      game.keyAction(key);
-    }
-    game.run();
-  }
-}
\ No newline at end of file
+void loop() { scheduler.run(); }
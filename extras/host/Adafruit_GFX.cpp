@@ -0,0 +1,32 @@
+#include "Adafruit_GFX.h"
+
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h) {}
+
+int16_t Adafruit_GFX::width() const { return WIDTH; }
+
+int16_t Adafruit_GFX::height() const { return HEIGHT; }
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                 uint16_t color) {
+  fillRect(x, y, w, 1, color);
+}
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                 uint16_t color) {
+  fillRect(x, y, 1, h, color);
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                            uint16_t color) {
+  for (int16_t i = x; i < x + w; i++) {
+    for (int16_t j = y; j < y + h; j++) {
+      drawPixel(i, j, color);
+    }
+  }
+}
+
+void Adafruit_GFX::fillScreen(uint16_t color) {
+  fillRect(0, 0, WIDTH, HEIGHT, color);
+}
+
+size_t Adafruit_GFX::write(uint8_t) { return 1; }
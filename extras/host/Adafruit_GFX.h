@@ -0,0 +1,42 @@
+#ifndef HOST_ADAFRUIT_GFX_H
+#define HOST_ADAFRUIT_GFX_H
+
+/**
+ * @brief Host stand-in for the Adafruit_GFX library header.
+ *
+ * Some font headers of the library include Adafruit_GFX.h; on the host the
+ * drawing primitives of the sketch live in the RGBmatrixPanel emulator
+ * instead. The Adafruit_GFX class is only the base of other panel drivers.
+ */
+#include "Arduino.h"
+#include "avr/pgmspace.h"
+#include "gfxfont.h"
+
+/**
+ * @brief Minimal host version of the Adafruit_GFX base class.
+ *
+ * Has the drawing primitives a driver overrides, implemented with drawPixel
+ * like in the library. Text is not drawn.
+ */
+class Adafruit_GFX : public Print {
+ protected:
+  int16_t WIDTH;   ///< Width of the display in pixels.
+  int16_t HEIGHT;  ///< Height of the display in pixels.
+
+ public:
+  Adafruit_GFX(int16_t w, int16_t h);
+
+  int16_t width() const;
+  int16_t height() const;
+
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+  virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                        uint16_t color);
+  virtual void fillScreen(uint16_t color);
+
+  size_t write(uint8_t c) override;
+};
+
+#endif
@@ -0,0 +1,175 @@
+#include "Arduino.h"
+
+#include <stdio.h>
+
+/**
+ * @brief The simulated time in microseconds.
+ */
+static unsigned long hostMicros = 0;
+
+volatile uint8_t hostPinPorts[NUM_DIGITAL_PINS];
+
+HostPort PORTA;
+volatile uint8_t DDRA;
+volatile uint8_t TCCR1A;
+volatile uint8_t TCCR1B;
+volatile uint8_t TIMSK1;
+volatile uint16_t OCR1A;
+volatile uint16_t TCNT1;
+
+unsigned long millis() { return hostMicros / 1000; }
+
+unsigned long micros() { return hostMicros; }
+
+void delay(unsigned long ms) { hostMicros += ms * 1000; }
+
+void delayMicroseconds(unsigned int us) { hostMicros += us; }
+
+void hostAdvanceMicros(unsigned long us) { hostMicros += us; }
+
+void pinMode(uint8_t, uint8_t) {}
+
+void digitalWrite(uint8_t, uint8_t) {}
+
+int digitalRead(uint8_t) { return LOW; }
+
+int analogRead(uint8_t) { return 0; }
+
+void tone(uint8_t, unsigned int, unsigned long) {}
+
+void noTone(uint8_t) {}
+
+long random(long howBig) { return howBig > 0 ? rand() % howBig : 0; }
+
+long random(long howSmall, long howBig) {
+  return howSmall < howBig ? howSmall + random(howBig - howSmall) : howSmall;
+}
+
+void randomSeed(unsigned long seed) { srand(seed); }
+
+HostPort& HostPort::operator=(uint8_t newValue) {
+  value = newValue;
+  if (writes < HOST_PORT_LOG) {
+    log[writes++] = newValue;
+  }
+  return *this;
+}
+
+HostPort& HostPort::operator|=(uint8_t bits) { return *this = value | bits; }
+
+HostPort& HostPort::operator&=(uint8_t bits) { return *this = value & bits; }
+
+HostPort::operator uint8_t() const { return value; }
+
+void HostPort::clearLog() { writes = 0; }
+
+uint16_t HostPort::getWrites() const { return writes; }
+
+uint8_t HostPort::getWrite(uint16_t index) const { return log[index]; }
+
+void interrupts() {}
+
+void noInterrupts() {}
+
+size_t Print::print(const char* text) {
+  size_t n = 0;
+  while (*text) {
+    n += write(*text++);
+  }
+  return n;
+}
+
+size_t Print::print(const __FlashStringHelper* text) {
+  return print(reinterpret_cast<const char*>(text));
+}
+
+size_t Print::print(char c) { return write(c); }
+
+size_t Print::print(unsigned char value, int base) {
+  return printNumber(value, base);
+}
+
+size_t Print::print(int value, int base) { return print(long(value), base); }
+
+size_t Print::print(unsigned int value, int base) {
+  return printNumber(value, base);
+}
+
+size_t Print::print(long value, int base) {
+  if (value < 0 && base == DEC) {
+    return write('-') + printNumber(-static_cast<unsigned long>(value), base);
+  }
+  return printNumber(value, base);
+}
+
+size_t Print::print(unsigned long value, int base) {
+  return printNumber(value, base);
+}
+
+size_t Print::println() { return write('\n'); }
+
+size_t Print::println(const char* text) { return print(text) + println(); }
+
+size_t Print::println(const __FlashStringHelper* text) {
+  return print(text) + println();
+}
+
+size_t Print::println(char c) { return print(c) + println(); }
+
+size_t Print::println(unsigned char value, int base) {
+  return print(value, base) + println();
+}
+
+size_t Print::println(int value, int base) {
+  return print(value, base) + println();
+}
+
+size_t Print::println(unsigned int value, int base) {
+  return print(value, base) + println();
+}
+
+size_t Print::println(long value, int base) {
+  return print(value, base) + println();
+}
+
+size_t Print::println(unsigned long value, int base) {
+  return print(value, base) + println();
+}
+
+/**
+ * @brief Prints an unsigned number in the given base.
+ *
+ * @param value The number to print.
+ * @param base The base, 2 to 16.
+ * @return The number of characters written.
+ */
+size_t Print::printNumber(unsigned long value, int base) {
+  char digits[8 * sizeof(unsigned long) + 1];
+  char* digit = &digits[sizeof(digits) - 1];
+  *digit = '\0';
+
+  if (base < 2 || base > 16) {
+    base = DEC;
+  }
+
+  do {
+    *--digit = "0123456789ABCDEF"[value % base];
+    value /= base;
+  } while (value != 0);
+
+  return print(digit);
+}
+
+void HardwareSerial::begin(unsigned long) {}
+
+int HardwareSerial::available() { return 0; }
+
+int HardwareSerial::read() { return -1; }
+
+size_t HardwareSerial::write(uint8_t c) {
+  putchar(c);
+  return 1;
+}
+
+HardwareSerial Serial;
+HardwareSerial Serial1;
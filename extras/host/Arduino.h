@@ -0,0 +1,143 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "avr/io.h"
+
+/**
+ * @brief Host replacement for the parts of the Arduino core the sketch uses.
+ *
+ * Time is simulated: millis and micros only move when the host program calls
+ * hostAdvanceMicros or the sketch calls delay, so runs are reproducible and
+ * independent of the speed of the host. Serial output goes to stdout, all
+ * other I/O does nothing. Port and timer registers are plain variables, see
+ * avr/io.h.
+ */
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+
+#define A0 54
+#define A1 55
+#define A2 56
+#define A3 57
+#define A4 58
+#define A5 59
+
+/**
+ * @brief Number of pins of an Arduino Mega.
+ */
+#define NUM_DIGITAL_PINS 70
+
+/**
+ * @brief Port of a pin; every pin has a port of its own on the host, with
+ * the pin on bit 0.
+ */
+#define digitalPinToPort(pin) (pin)
+#define digitalPinToBitMask(pin) ((uint8_t)1)
+#define portOutputRegister(port) (&hostPinPorts[port])
+
+/**
+ * @brief Output registers of the pins, written only through
+ * portOutputRegister.
+ */
+extern volatile uint8_t hostPinPorts[NUM_DIGITAL_PINS];
+
+#define DEC 10
+#define HEX 16
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+
+/**
+ * @brief Marker type of strings stored in program memory.
+ */
+class __FlashStringHelper;
+#define F(string) (reinterpret_cast<const __FlashStringHelper*>(string))
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+
+void tone(uint8_t pin, unsigned int frequency, unsigned long duration = 0);
+void noTone(uint8_t pin);
+
+long random(long howBig);
+long random(long howSmall, long howBig);
+void randomSeed(unsigned long seed);
+
+void interrupts();
+void noInterrupts();
+
+/**
+ * @brief Advances the simulated clock (host only).
+ *
+ * @param us The number of microseconds to advance.
+ */
+void hostAdvanceMicros(unsigned long us);
+
+/**
+ * @brief Formatted text output, shared by Serial and the display.
+ *
+ * Subclasses only implement write; every print overload ends up there one
+ * character at a time, like on the board.
+ */
+class Print {
+ public:
+  virtual ~Print() {}
+
+  virtual size_t write(uint8_t c) = 0;
+
+  size_t print(const char* text);
+  size_t print(const __FlashStringHelper* text);
+  size_t print(char c);
+  size_t print(unsigned char value, int base = DEC);
+  size_t print(int value, int base = DEC);
+  size_t print(unsigned int value, int base = DEC);
+  size_t print(long value, int base = DEC);
+  size_t print(unsigned long value, int base = DEC);
+
+  size_t println();
+  size_t println(const char* text);
+  size_t println(const __FlashStringHelper* text);
+  size_t println(char c);
+  size_t println(unsigned char value, int base = DEC);
+  size_t println(int value, int base = DEC);
+  size_t println(unsigned int value, int base = DEC);
+  size_t println(long value, int base = DEC);
+  size_t println(unsigned long value, int base = DEC);
+
+ private:
+  size_t printNumber(unsigned long value, int base);
+};
+
+/**
+ * @brief A serial port; input is never available on the host.
+ */
+class HardwareSerial : public Print {
+ public:
+  void begin(unsigned long baud);
+  int available();
+  int read();
+  size_t write(uint8_t c) override;
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+
+#endif
@@ -0,0 +1,170 @@
+/**
+ * @file BakeScreens.cpp
+ * @brief Pre-renders the static screens of the sketch into BakedScreens.h.
+ *
+ * Draws the title, HUD frame and game over screens on the panel emulator the
+ * way the sketch does without DISPLAY_BAKED_SCREENS, maps every pixel back to
+ * its Colors index and writes the screens as run-length encoded images in the
+ * format drawScreen decodes.
+ *
+ * Usage: bake_screens [output file]
+ *
+ * Writes to stdout without an output file. Build it with the real fonts and
+ * with DISPLAY_BAKED_SCREENS set to 0, see README.md.
+ */
+
+#include <stdio.h>
+
+#include "../../src/Display.h"
+#include "Fonts/FreeMonoBold9pt7b.h"
+#include "Fonts/Picopixel.h"
+
+#if DISPLAY_BAKED_SCREENS
+#error "Build bake_screens with -DDISPLAY_BAKED_SCREENS=0"
+#endif
+
+/**
+ * @brief Longest run a single run can encode.
+ */
+#define BAKE_MAX_RUN (16 + 255)
+
+/**
+ * @brief Encoded bytes written per line of the generated header.
+ */
+#define BAKE_BYTES_PER_LINE 12
+
+/**
+ * @brief A static screen and the function that draws it.
+ */
+struct BakedScreen {
+  const char* name;  ///< Name of the array in the generated header.
+  void (*draw)();    ///< Draws the screen on the panel.
+};
+
+static void drawTitleScreen() { Display::initDisplay(); }
+
+static const BakedScreen SCREENS[] = {
+    {"TITLE_SCREEN", drawTitleScreen},
+    {"HUD_SCREEN", drawStaticElements},
+    {"GAME_OVER_SCREEN", gameOverDisplay},
+};
+
+/**
+ * @brief Finds the Colors index of a panel pixel.
+ *
+ * @param x The x-coordinate of the pixel.
+ * @param y The y-coordinate of the pixel.
+ * @return The index of the pixel's color, or NUM_COLORS if it is not a
+ * display color.
+ */
+static uint8_t pixelColor(uint8_t x, uint8_t y) {
+  uint16_t rgb = matrix.getPixel(x, y);
+
+  for (uint8_t color = 0; color < NUM_COLORS; color++) {
+    if (Display::getColor(static_cast<Colors>(color)) == rgb) {
+      return color;
+    }
+  }
+  return NUM_COLORS;
+}
+
+/**
+ * @brief Appends a run to the encoded screen.
+ *
+ * @param out The encoded screen.
+ * @param size The number of encoded bytes, advanced past the run.
+ * @param color The Colors index of the run.
+ * @param length The length of the run, 1 to BAKE_MAX_RUN.
+ */
+static void writeRun(uint8_t* out, uint16_t& size, uint8_t color,
+                     uint16_t length) {
+  if (length < 16) {
+    out[size++] = color << 4 | (length - 1);
+  } else {
+    out[size++] = color << 4 | 0x0F;
+    out[size++] = length - 16;
+  }
+}
+
+/**
+ * @brief Encodes what the panel shows.
+ *
+ * @param out Receives the encoded screen, at most two bytes per pixel.
+ * @return The number of encoded bytes, or 0 if a pixel has a color outside
+ * the display colors.
+ */
+static uint16_t encodeScreen(uint8_t* out) {
+  uint16_t size = 0;
+  uint8_t runColor = 0;
+  uint16_t runLength = 0;
+
+  for (uint16_t pixel = 0; pixel < SCREEN_WIDTH * SCREEN_HEIGHT; pixel++) {
+    uint8_t color = pixelColor(pixel % SCREEN_WIDTH, pixel / SCREEN_WIDTH);
+    if (color == NUM_COLORS) {
+      fprintf(stderr, "unknown color at %u, %u\n", pixel % SCREEN_WIDTH,
+              pixel / SCREEN_WIDTH);
+      return 0;
+    }
+
+    if (runLength > 0 && (color != runColor || runLength == BAKE_MAX_RUN)) {
+      writeRun(out, size, runColor, runLength);
+      runLength = 0;
+    }
+    runColor = color;
+    runLength++;
+  }
+  writeRun(out, size, runColor, runLength);
+
+  return size;
+}
+
+int main(int argc, char** argv) {
+  // The fallback fonts have no glyphs and would bake screens without text
+  if (!FreeMonoBold9pt7b.glyph || !Picopixel.glyph) {
+    fprintf(stderr,
+            "built with the fallback fonts, build with "
+            "-I<Adafruit-GFX-Library>\n");
+    return 1;
+  }
+
+  FILE* file = argc > 1 ? fopen(argv[1], "w") : stdout;
+  if (!file) {
+    perror(argv[1]);
+    return 1;
+  }
+
+  fprintf(file,
+          "/**\n"
+          " * @file BakedScreens.h\n"
+          " * @brief Static screens pre-rendered by extras/host/"
+          "BakeScreens.cpp.\n"
+          " *\n"
+          " * Generated, do not edit. Run-length encoded as described at "
+          "drawScreen.\n"
+          " */\n\n"
+          "#ifndef BAKED_SCREENS_H\n"
+          "#define BAKED_SCREENS_H\n\n"
+          "#include <avr/pgmspace.h>\n");
+
+  for (const BakedScreen& screen : SCREENS) {
+    static uint8_t encoded[SCREEN_WIDTH * SCREEN_HEIGHT * 2];
+
+    screen.draw();
+    uint16_t size = encodeScreen(encoded);
+    if (size == 0) {
+      fprintf(stderr, "%s: not encoded\n", screen.name);
+      return 1;
+    }
+
+    fprintf(file, "\nconst uint8_t %s[] PROGMEM = {", screen.name);
+    for (uint16_t i = 0; i < size; i++) {
+      fprintf(file, "%s0x%02X,", i % BAKE_BYTES_PER_LINE ? " " : "\n    ",
+              encoded[i]);
+    }
+    fprintf(file, "\n};\n");
+    fprintf(stderr, "%s: %u bytes\n", screen.name, size);
+  }
+
+  fprintf(file, "\n#endif\n");
+  return file == stdout || fclose(file) == 0 ? 0 : 1;
+}
@@ -0,0 +1,29 @@
+#ifndef HOST_DFROBOT_DFPLAYER_MINI_H
+#define HOST_DFROBOT_DFPLAYER_MINI_H
+
+#include "Arduino.h"
+
+/**
+ * @brief Host replacement for the DFPlayer Mini library.
+ *
+ * The player is always present and silent, and never reports an event.
+ */
+
+#define DFPlayerPlayFinished 5
+
+class DFRobotDFPlayerMini {
+ public:
+  bool begin(HardwareSerial&, bool = true, bool = true) { return true; }
+  bool available() { return false; }
+  uint8_t readType() { return 0; }
+  void volume(uint8_t) {}
+  void volumeUp() {}
+  void volumeDown() {}
+  void play(int) {}
+  void pause() {}
+  void start() {}
+  void stop() {}
+  void reset() {}
+};
+
+#endif
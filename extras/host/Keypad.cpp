@@ -0,0 +1,49 @@
+#include "Keypad.h"
+
+/**
+ * @brief Maximum number of queued key presses.
+ */
+#define HOST_KEY_QUEUE_SIZE 16
+
+/**
+ * @brief A queued key press.
+ */
+struct HostKeyPress {
+  char key;                ///< The pressed key.
+  unsigned long atMillis;  ///< Time from which the press is reported.
+};
+
+static HostKeyPress keyQueue[HOST_KEY_QUEUE_SIZE];
+static uint8_t keyHead = 0;
+static uint8_t keyCount = 0;
+
+void hostPressKey(char key, unsigned long atMillis) {
+  if (keyCount < HOST_KEY_QUEUE_SIZE) {
+    uint8_t tail = (keyHead + keyCount) % HOST_KEY_QUEUE_SIZE;
+    HostKeyPress& press = keyQueue[tail];
+    press.key = key;
+    press.atMillis = atMillis;
+    keyCount++;
+  }
+}
+
+Keypad::Keypad(char*, byte*, byte*, byte, byte) : state(IDLE) {}
+
+char Keypad::getKey() {
+  if (keyCount == 0 || millis() < keyQueue[keyHead].atMillis) {
+    state = IDLE;
+    return NO_KEY;
+  }
+
+  char key = keyQueue[keyHead].key;
+  keyHead = (keyHead + 1) % HOST_KEY_QUEUE_SIZE;
+  keyCount--;
+  state = PRESSED;
+  return key;
+}
+
+KeyState Keypad::getState() { return state; }
+
+void Keypad::setDebounceTime(unsigned int) {}
+
+void Keypad::setHoldTime(unsigned int) {}
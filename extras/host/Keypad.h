@@ -0,0 +1,41 @@
+#ifndef HOST_KEYPAD_H
+#define HOST_KEYPAD_H
+
+#include "Arduino.h"
+
+/**
+ * @brief Host replacement for the Keypad library.
+ *
+ * There is no key matrix to scan; the host program queues key presses with
+ * hostPressKey, and getKey reports each of them once as a fresh press as soon
+ * as its time has come.
+ */
+
+#define NO_KEY '\0'
+#define makeKeymap(keymap) ((char*)keymap)
+
+enum KeyState { IDLE, PRESSED, HOLD, RELEASED };
+
+class Keypad {
+ private:
+  KeyState state;  ///< State of the key returned last.
+
+ public:
+  Keypad(char* userKeymap, byte* rowPins, byte* colPins, byte numRows,
+         byte numCols);
+
+  char getKey();
+  KeyState getState();
+  void setDebounceTime(unsigned int debounce);
+  void setHoldTime(unsigned int hold);
+};
+
+/**
+ * @brief Queues a key press (host only).
+ *
+ * @param key The key to press.
+ * @param atMillis The simulated time from which getKey reports the press.
+ */
+void hostPressKey(char key, unsigned long atMillis = 0);
+
+#endif
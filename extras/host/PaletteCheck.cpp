@@ -0,0 +1,225 @@
+/**
+ * @file PaletteCheck.cpp
+ * @brief Runs the PaletteMatrix refresh interrupt on the host and checks what
+ * the panel would show.
+ *
+ * Draws a test pattern in all palette colors, calls the Timer1 compare A
+ * handler until every row of every bit plane has been shifted out once, and
+ * rebuilds the image from the row address pins and the color data written to
+ * PORTA. Every pixel must show its color reduced to PALETTE_MATRIX_PLANES
+ * bits per channel.
+ *
+ * Usage: palette_check
+ *
+ * Exits with 1 if a pixel differs. Build it with DISPLAY_PALETTE_DRIVER set
+ * to 1, see README.md.
+ */
+
+#include <stdio.h>
+
+#include "../../src/Display.h"
+
+#if !DISPLAY_PALETTE_DRIVER
+#error "Build palette_check with -DDISPLAY_PALETTE_DRIVER=1"
+#endif
+
+/**
+ * @brief Number of row addresses of the 64-row panel.
+ */
+#define CHECK_ROW_PAIRS 32
+
+/**
+ * @brief Size of the panel in pixels.
+ */
+#define CHECK_WIDTH 64
+#define CHECK_HEIGHT (CHECK_ROW_PAIRS * 2)
+
+extern "C" void TIMER1_COMPA_vect();
+
+/**
+ * @brief Test palette with distinct channel values, stored in program memory.
+ */
+const uint16_t CHECK_PALETTE[PALETTE_MATRIX_COLORS] PROGMEM = {
+    0x0000, 0xF800, 0x07E0, 0x001F, 0xFFE0, 0xF81F, 0x07FF, 0xFFFF,
+    0x8000, 0x0400, 0x0010, 0x8410, 0xFC00, 0x041F, 0x7BEF, 0xA145};
+
+static PaletteMatrix panel(A, B, C, D, E, CLK, LAT, OE, false, CHECK_WIDTH);
+
+static uint16_t expected[CHECK_HEIGHT][CHECK_WIDTH];  ///< Colors drawn.
+static uint8_t shown[CHECK_HEIGHT][CHECK_WIDTH];      ///< Bits shifted out.
+
+/**
+ * @brief Fills a rectangle on the panel and in the expected image.
+ *
+ * @param x The x-coordinate of the top-left corner, may lie outside.
+ * @param y The y-coordinate of the top-left corner, may lie outside.
+ * @param w The width of the rectangle.
+ * @param h The height of the rectangle.
+ * @param color The palette index of the color.
+ */
+static void fill(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t color) {
+  uint16_t rgb = pgm_read_word(&CHECK_PALETTE[color]);
+
+  if (h == 1) {
+    panel.drawFastHLine(x, y, w, rgb);
+  } else if (w == 1) {
+    panel.drawFastVLine(x, y, h, rgb);
+  } else {
+    panel.fillRect(x, y, w, h, rgb);
+  }
+
+  for (int16_t j = y; j < y + h; j++) {
+    for (int16_t i = x; i < x + w; i++) {
+      if (i >= 0 && j >= 0 && i < CHECK_WIDTH && j < CHECK_HEIGHT) {
+        expected[j][i] = rgb;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Draws the test pattern.
+ *
+ * Covers every pair of palette indices in the upper and lower half, as well
+ * as rectangles and lines clipped at the edges.
+ */
+static void drawPattern() {
+  panel.fillScreen(pgm_read_word(&CHECK_PALETTE[3]));
+
+  for (int16_t y = 0; y < CHECK_HEIGHT; y++) {
+    for (int16_t x = 0; x < CHECK_WIDTH; x++) {
+      uint8_t color = (x + y * 3 + (y >= CHECK_ROW_PAIRS ? x / 16 : 0)) %
+                      PALETTE_MATRIX_COLORS;
+      uint16_t rgb = pgm_read_word(&CHECK_PALETTE[color]);
+      panel.drawPixel(x, y, rgb);
+      expected[y][x] = rgb;
+    }
+  }
+
+  fill(10, 20, 30, 15, 5);
+  fill(-5, 40, 20, 1, 7);
+  fill(50, 60, 1, 10, 9);
+  fill(60, -3, 10, 8, 12);
+}
+
+/**
+ * @brief Reads the row address the panel shows.
+ *
+ * @return The row pair selected by the address pins A to E.
+ */
+static uint8_t addressedRow() {
+  const uint8_t addressPins[5] = {A, B, C, D, E};
+  uint8_t row = 0;
+
+  for (uint8_t i = 0; i < 5; i++) {
+    if (hostPinPorts[addressPins[i]] & 1) {
+      row |= 1 << i;
+    }
+  }
+  return row;
+}
+
+/**
+ * @brief Simulates one refresh interrupt.
+ *
+ * Clears the log of PORTA first, so it holds only the row shifted out by this
+ * interrupt, which the next one latches.
+ */
+static void interrupt() {
+  PORTA.clearLog();
+  TIMER1_COMPA_vect();
+}
+
+/**
+ * @brief Records the data shifted out by the last interrupt.
+ *
+ * @param row The row pair that was shifted out.
+ * @param plane The bit plane that was shifted out.
+ * @return False if the interrupt did not shift out a whole row.
+ */
+static bool record(uint8_t row, uint8_t plane) {
+  if (PORTA.getWrites() != CHECK_WIDTH) {
+    return false;
+  }
+
+  for (uint8_t x = 0; x < CHECK_WIDTH; x++) {
+    uint8_t bits = PORTA.getWrite(x);
+    for (uint8_t channel = 0; channel < 3; channel++) {
+      shown[row][x] |= ((bits >> (2 + channel)) & 1) << (plane * 3 + channel);
+      shown[row + CHECK_ROW_PAIRS][x] |= ((bits >> (5 + channel)) & 1)
+                                         << (plane * 3 + channel);
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Reduces a color the way the panel shows it.
+ *
+ * @param color The 5-6-5 bit color.
+ * @return The bits of every plane in the layout of shown.
+ */
+static uint8_t reduce(uint16_t color) {
+  const uint8_t levels = (1 << PALETTE_MATRIX_PLANES) - 1;
+
+  uint8_t red = ((color >> 11) * levels + 15) / 31;
+  uint8_t green = (((color >> 5) & 0x3F) * levels + 31) / 63;
+  uint8_t blue = ((color & 0x1F) * levels + 15) / 31;
+  uint8_t bits = 0;
+
+  for (uint8_t plane = 0; plane < PALETTE_MATRIX_PLANES; plane++) {
+    bits |= (((red >> plane) & 1) | ((green >> plane) & 1) << 1 |
+             ((blue >> plane) & 1) << 2)
+            << (plane * 3);
+  }
+  return bits;
+}
+
+int main() {
+  panel.setPalette(CHECK_PALETTE, PALETTE_MATRIX_COLORS);
+  panel.begin();
+  drawPattern();
+
+  // Wait for the wrap from the last row to the first. That interrupt latches
+  // step 0, row 0 of plane 0, and shifts out step 1.
+  uint8_t previousRow;
+  uint16_t interrupts = 0;
+  do {
+    previousRow = addressedRow();
+    interrupt();
+    if (++interrupts > CHECK_ROW_PAIRS * PALETTE_MATRIX_PLANES * 2) {
+      fprintf(stderr, "row address never wraps\n");
+      return 1;
+    }
+  } while (previousRow != CHECK_ROW_PAIRS - 1 || addressedRow() != 0);
+
+  for (uint16_t step = 1; step <= CHECK_ROW_PAIRS * PALETTE_MATRIX_PLANES;
+       step++) {
+    uint8_t plane = step % PALETTE_MATRIX_PLANES;
+    uint8_t row = (step / PALETTE_MATRIX_PLANES) % CHECK_ROW_PAIRS;
+
+    if (step > 1) {
+      interrupt();
+    }
+    if (!record(row, plane)) {
+      fprintf(stderr, "row %u, plane %u: %u port writes\n", row, plane,
+              PORTA.getWrites());
+      return 1;
+    }
+  }
+
+  uint16_t differences = 0;
+  for (uint8_t y = 0; y < CHECK_HEIGHT; y++) {
+    for (uint8_t x = 0; x < CHECK_WIDTH; x++) {
+      if (shown[y][x] != reduce(expected[y][x])) {
+        if (differences++ < 10) {
+          fprintf(stderr, "%u, %u: shows %02x instead of %02x\n", x, y,
+                  shown[y][x], reduce(expected[y][x]));
+        }
+      }
+    }
+  }
+
+  printf("%u of %u pixels differ\n", differences, CHECK_WIDTH * CHECK_HEIGHT);
+  return differences > 0;
+}
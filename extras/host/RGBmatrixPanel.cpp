@@ -0,0 +1,279 @@
+#include "RGBmatrixPanel.h"
+
+#include <stdio.h>
+
+#if defined(__has_include)
+#if __has_include(<glcdfont.c>)
+#include <glcdfont.c>
+#define HOST_CLASSIC_FONT ::font
+#endif
+#endif
+
+RGBmatrixPanel::RGBmatrixPanel(uint8_t, uint8_t, uint8_t, uint8_t, uint8_t,
+                               uint8_t, uint8_t, uint8_t, bool dbuf, uint8_t)
+    : buffers(),
+      front(0),
+      back(dbuf ? 1 : 0),
+      stats(),
+      font(nullptr),
+      cursorX(0),
+      cursorY(0),
+      textColor(0xFFFF),
+      textBackground(0xFFFF),
+      wrap(true) {}
+
+void RGBmatrixPanel::begin() {}
+
+int16_t RGBmatrixPanel::width() const { return HOST_PANEL_WIDTH; }
+
+int16_t RGBmatrixPanel::height() const { return HOST_PANEL_HEIGHT; }
+
+void RGBmatrixPanel::writePixel(int16_t x, int16_t y, uint16_t color) {
+  if (x >= 0 && y >= 0 && x < HOST_PANEL_WIDTH && y < HOST_PANEL_HEIGHT) {
+    buffers[back][y][x] = color;
+    stats.pixelsTouched++;
+  }
+}
+
+void RGBmatrixPanel::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  stats.pixelCalls++;
+  writePixel(x, y, color);
+}
+
+void RGBmatrixPanel::fillScreen(uint16_t color) {
+  fillRect(0, 0, HOST_PANEL_WIDTH, HOST_PANEL_HEIGHT, color);
+}
+
+void RGBmatrixPanel::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                              uint16_t color) {
+  stats.rectCalls++;
+  for (int16_t row = y; row < y + h; row++) {
+    for (int16_t col = x; col < x + w; col++) {
+      writePixel(col, row, color);
+    }
+  }
+}
+
+void RGBmatrixPanel::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                   uint16_t color) {
+  stats.lineCalls++;
+  for (int16_t col = x; col < x + w; col++) {
+    writePixel(col, y, color);
+  }
+}
+
+void RGBmatrixPanel::drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                   uint16_t color) {
+  stats.lineCalls++;
+  for (int16_t row = y; row < y + h; row++) {
+    writePixel(x, row, color);
+  }
+}
+
+void RGBmatrixPanel::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                              uint16_t color) {
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y, h, color);
+  drawFastVLine(x + w - 1, y, h, color);
+}
+
+/**
+ * @brief Sets the font for the following text.
+ *
+ * Like Adafruit_GFX, moves the cursor between the top-left origin of the
+ * classic font and the baseline origin of proportional fonts.
+ */
+void RGBmatrixPanel::setFont(const GFXfont* newFont) {
+  if (newFont && !font) {
+    cursorY += 6;
+  } else if (!newFont && font) {
+    cursorY -= 6;
+  }
+  font = newFont;
+}
+
+void RGBmatrixPanel::setCursor(int16_t x, int16_t y) {
+  cursorX = x;
+  cursorY = y;
+}
+
+void RGBmatrixPanel::setTextColor(uint16_t color) {
+  textColor = color;
+  textBackground = color;
+}
+
+void RGBmatrixPanel::setTextColor(uint16_t color, uint16_t background) {
+  textColor = color;
+  textBackground = background;
+}
+
+void RGBmatrixPanel::setTextWrap(bool enabled) { wrap = enabled; }
+
+/**
+ * @brief Draws a character of the classic 5x7 font.
+ *
+ * Five columns of glyph data plus one blank column; the background is only
+ * drawn when it differs from the text color.
+ */
+void RGBmatrixPanel::drawClassicChar(int16_t x, int16_t y, uint8_t c) {
+#ifdef HOST_CLASSIC_FONT
+  bool opaque = textBackground != textColor;
+
+  for (uint8_t col = 0; col < 6; col++) {
+    uint8_t bits = col < 5 ? HOST_CLASSIC_FONT[c * 5 + col] : 0;
+
+    for (uint8_t row = 0; row < 8; row++, bits >>= 1) {
+      if (bits & 1) {
+        writePixel(x + col, y + row, textColor);
+      } else if (opaque) {
+        writePixel(x + col, y + row, textBackground);
+      }
+    }
+  }
+#else
+  (void)x;
+  (void)y;
+  (void)c;
+#endif
+}
+
+/**
+ * @brief Draws a character of the current proportional font.
+ *
+ * Glyph bitmaps are packed row by row, most significant bit first, without
+ * padding between rows.
+ */
+void RGBmatrixPanel::drawFontChar(int16_t x, int16_t y, uint8_t c) {
+  const GFXglyph& glyph = font->glyph[c - font->first];
+  const uint8_t* bitmap = font->bitmap + glyph.bitmapOffset;
+  uint8_t bits = 0;
+  uint16_t bit = 0;
+
+  for (uint8_t row = 0; row < glyph.height; row++) {
+    for (uint8_t col = 0; col < glyph.width; col++, bit++, bits <<= 1) {
+      if (bit % 8 == 0) {
+        bits = *bitmap++;
+      }
+      if (bits & 0x80) {
+        writePixel(x + glyph.xOffset + col, y + glyph.yOffset + row,
+                   textColor);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Writes a character at the cursor and advances it.
+ *
+ * Follows the cursor and wrapping rules of Adafruit_GFX. Characters outside
+ * the current font are skipped without moving the cursor.
+ */
+size_t RGBmatrixPanel::write(uint8_t c) {
+  if (c == '\r') {
+    return 1;
+  }
+
+  if (!font) {
+    if (c == '\n') {
+      cursorX = 0;
+      cursorY += 8;
+      return 1;
+    }
+    if (wrap && cursorX + 6 > HOST_PANEL_WIDTH) {
+      cursorX = 0;
+      cursorY += 8;
+    }
+    stats.textCalls++;
+    drawClassicChar(cursorX, cursorY, c);
+    cursorX += 6;
+    return 1;
+  }
+
+  if (c == '\n') {
+    cursorX = 0;
+    cursorY += font->yAdvance;
+    return 1;
+  }
+  if (c < font->first || c > font->last) {
+    return 1;
+  }
+
+  const GFXglyph& glyph = font->glyph[c - font->first];
+  if (glyph.width > 0 && glyph.height > 0) {
+    if (wrap && cursorX + glyph.xOffset + glyph.width > HOST_PANEL_WIDTH) {
+      cursorX = 0;
+      cursorY += font->yAdvance;
+    }
+    stats.textCalls++;
+    drawFontChar(cursorX, cursorY, c);
+  }
+  cursorX += glyph.xAdvance;
+  return 1;
+}
+
+/**
+ * @brief Shows the back buffer.
+ *
+ * Without double buffering there is only one buffer and nothing happens.
+ *
+ * @param copy Whether the new back buffer starts as a copy of the new front
+ * buffer.
+ */
+void RGBmatrixPanel::swapBuffers(bool copy) {
+  if (front == back) {
+    return;
+  }
+
+  uint8_t shown = back;
+  back = front;
+  front = shown;
+
+  if (copy) {
+    memcpy(buffers[back], buffers[front], sizeof(buffers[front]));
+  }
+}
+
+const PanelStats& RGBmatrixPanel::getStats() const { return stats; }
+
+void RGBmatrixPanel::resetStats() { stats = PanelStats(); }
+
+uint16_t RGBmatrixPanel::getPixel(int16_t x, int16_t y) const {
+  if (x < 0 || y < 0 || x >= HOST_PANEL_WIDTH || y >= HOST_PANEL_HEIGHT) {
+    return 0;
+  }
+  return buffers[front][y][x];
+}
+
+/**
+ * @brief Writes what the panel shows as a binary PPM image.
+ *
+ * The 5-6-5 bit colors are expanded to 8 bits per channel.
+ */
+bool RGBmatrixPanel::dumpPPM(const char* path, uint8_t scale) const {
+  if (scale == 0) {
+    scale = 1;
+  }
+
+  FILE* file = fopen(path, "wb");
+  if (!file) {
+    return false;
+  }
+
+  fprintf(file, "P6\n%d %d\n255\n", HOST_PANEL_WIDTH * scale,
+          HOST_PANEL_HEIGHT * scale);
+
+  for (uint16_t y = 0; y < HOST_PANEL_HEIGHT * scale; y++) {
+    for (uint16_t x = 0; x < HOST_PANEL_WIDTH * scale; x++) {
+      uint16_t color = buffers[front][y / scale][x / scale];
+      uint8_t rgb[3] = {
+          static_cast<uint8_t>((color >> 11) * 255 / 31),
+          static_cast<uint8_t>(((color >> 5) & 0x3F) * 255 / 63),
+          static_cast<uint8_t>((color & 0x1F) * 255 / 31),
+      };
+      fwrite(rgb, 1, sizeof(rgb), file);
+    }
+  }
+
+  return fclose(file) == 0;
+}
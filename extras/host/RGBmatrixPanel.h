@@ -0,0 +1,126 @@
+#ifndef HOST_RGB_MATRIX_PANEL_H
+#define HOST_RGB_MATRIX_PANEL_H
+
+#include "Adafruit_GFX.h"
+
+/**
+ * @brief Size of the emulated panel in pixels.
+ */
+#define HOST_PANEL_WIDTH 64
+#define HOST_PANEL_HEIGHT 64
+
+/**
+ * @brief Drawing work issued to the panel since the last reset.
+ *
+ * Calls are counted as the sketch issues them; pixelsTouched counts every
+ * pixel written inside the panel, whether or not it changed.
+ */
+struct PanelStats {
+  uint32_t pixelCalls;     ///< drawPixel calls.
+  uint32_t rectCalls;      ///< fillRect and fillScreen calls.
+  uint32_t lineCalls;      ///< Fast lines, four per drawRect.
+  uint32_t textCalls;      ///< Characters written.
+  uint32_t pixelsTouched;  ///< Pixels written by all of the above.
+};
+
+/**
+ * @brief Host emulator of the RGBmatrixPanel library.
+ *
+ * Keeps the panel content in a framebuffer of 16-bit colors, implements the
+ * Adafruit_GFX primitives the sketch uses with the same pixel semantics, and
+ * counts the work done. With double buffering enabled, drawing goes to the
+ * back buffer and only swapBuffers makes it visible, like on the panel.
+ *
+ * Text in the classic font is drawn when the Adafruit_GFX library's
+ * glcdfont.c is on the include path; otherwise it is only counted.
+ */
+class RGBmatrixPanel : public Print {
+ private:
+  /**
+   * @brief Pixel data of the front and the back buffer.
+   */
+  uint16_t buffers[2][HOST_PANEL_HEIGHT][HOST_PANEL_WIDTH];
+
+  uint8_t front;            ///< Index of the buffer the panel shows.
+  uint8_t back;             ///< Index of the buffer drawing goes to.
+  PanelStats stats;         ///< Drawing work since the last reset.
+  const GFXfont* font;      ///< Current font, nullptr for the classic font.
+  int16_t cursorX;          ///< X-coordinate of the text cursor.
+  int16_t cursorY;          ///< Y-coordinate of the text cursor.
+  uint16_t textColor;       ///< Foreground color of text.
+  uint16_t textBackground;  ///< Background color, equal to textColor if none.
+  bool wrap;                ///< Whether text wraps at the right edge.
+
+  /**
+   * @brief Writes a pixel to the back buffer if it lies inside the panel.
+   */
+  void writePixel(int16_t x, int16_t y, uint16_t color);
+
+  /**
+   * @brief Draws a character of the classic 5x7 font.
+   */
+  void drawClassicChar(int16_t x, int16_t y, uint8_t c);
+
+  /**
+   * @brief Draws a character of the current proportional font.
+   */
+  void drawFontChar(int16_t x, int16_t y, uint8_t c);
+
+ public:
+  RGBmatrixPanel(uint8_t a, uint8_t b, uint8_t c, uint8_t d, uint8_t e,
+                 uint8_t clk, uint8_t lat, uint8_t oe, bool dbuf,
+                 uint8_t width = 32);
+
+  void begin();
+
+  int16_t width() const;
+  int16_t height() const;
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color);
+  void fillScreen(uint16_t color);
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+  void setFont(const GFXfont* newFont);
+  void setCursor(int16_t x, int16_t y);
+  void setTextColor(uint16_t color);
+  void setTextColor(uint16_t color, uint16_t background);
+  void setTextWrap(bool enabled);
+  size_t write(uint8_t c) override;
+
+  void swapBuffers(bool copy = true);
+
+  /**
+   * @brief Retrieves the drawing work since the last reset (host only).
+   *
+   * @return The counters.
+   */
+  const PanelStats& getStats() const;
+
+  /**
+   * @brief Sets all counters to zero (host only).
+   */
+  void resetStats();
+
+  /**
+   * @brief Retrieves a pixel the panel shows (host only).
+   *
+   * @param x The x-coordinate of the pixel.
+   * @param y The y-coordinate of the pixel.
+   * @return The 16-bit color of the pixel, 0 outside the panel.
+   */
+  uint16_t getPixel(int16_t x, int16_t y) const;
+
+  /**
+   * @brief Writes what the panel shows as a binary PPM image (host only).
+   *
+   * @param path The file to write.
+   * @param scale The edge length of a panel pixel in the image.
+   * @return True if the file was written, otherwise false.
+   */
+  bool dumpPPM(const char* path, uint8_t scale = 4) const;
+};
+
+#endif
@@ -0,0 +1,341 @@
+/**
+ * @file RenderCost.cpp
+ * @brief Measures the panel work of the sketch per game event on the host.
+ *
+ * Runs the unmodified sketch against the panel emulator with a simulated
+ * clock. A simple autopilot plays the games and pauses now and then. The
+ * panel work is attributed to the event that caused it: the frames right
+ * after a lock, a line clear, pausing or unpausing belong to that event, and
+ * all other frames count as idle.
+ *
+ * Usage: render_cost [games] [dump directory]
+ *
+ * With a dump directory, the panel is written as a PPM image once after the
+ * first occurrence of every event.
+ *
+ * Finally prints how many pixels and cells the board's shadow buffer pushed
+ * to the panel and in how many draw calls since startup.
+ */
+
+#include <stdio.h>
+
+#include "../../Tetris.ino"
+
+/**
+ * @brief Number of games played when none is given.
+ */
+#define RENDER_COST_GAMES 10
+
+/**
+ * @brief Simulated time per iteration of the sketch's loop in microseconds.
+ */
+#define RENDER_COST_LOOP_TIME 500
+
+/**
+ * @brief Time between two key presses of the autopilot in milliseconds.
+ */
+#define RENDER_COST_KEY_INTERVAL 40
+
+/**
+ * @brief Time between two pauses of the autopilot in milliseconds.
+ */
+#define RENDER_COST_PAUSE_INTERVAL 7000
+
+/**
+ * @brief Time a pause lasts in milliseconds.
+ */
+#define RENDER_COST_PAUSE_TIME 500
+
+/**
+ * @brief Events the panel work is attributed to.
+ */
+enum RenderEvent {
+  IDLE_EVENT,
+  LOCK_EVENT,
+  LINE_CLEAR_EVENT,
+  PAUSE_EVENT,
+  UNPAUSE_EVENT,
+  GAME_OVER_EVENT,
+  NUM_EVENTS
+};
+
+const char* const EVENT_NAMES[NUM_EVENTS] = {
+    "idle frame", "lock", "line_clear", "pause", "unpause", "game_over"};
+
+/**
+ * @brief Time after an event during which the panel work belongs to it.
+ *
+ * One frame, or the whole animation for a line clear, whose collapse takes up
+ * to four drop steps. The game over screen and the start of the next game
+ * belong to the game over event.
+ */
+const unsigned long EVENT_WINDOWS[NUM_EVENTS] = {
+    0,
+    FRAME_INTERVAL,
+    LINE_CLEAR_FLASHES * LINE_CLEAR_STEP_TIME + 3 * LINE_CLEAR_DROP_TIME +
+        FRAME_INTERVAL,
+    FRAME_INTERVAL,
+    FRAME_INTERVAL,
+    FRAME_INTERVAL};
+
+/**
+ * @brief Panel work accumulated for one kind of event.
+ */
+struct EventCost {
+  uint32_t count;      ///< Number of occurrences, or frames when idle.
+  uint64_t pixels;     ///< Pixels touched in total.
+  uint64_t calls;      ///< Draw calls issued in total.
+  uint32_t maxPixels;  ///< Pixels touched by the most expensive booking.
+};
+
+static EventCost costs[NUM_EVENTS];
+
+/**
+ * @brief Books the panel work since the last reset on an event.
+ *
+ * @param event The event that caused the work.
+ * @param occurrences The number of occurrences the work covers; idle work
+ * is booked per loop iteration and counted in frames at the end.
+ */
+static void bookCost(RenderEvent event, uint32_t occurrences) {
+  const PanelStats& stats = matrix.getStats();
+  EventCost& cost = costs[event];
+
+  cost.count += occurrences;
+  cost.pixels += stats.pixelsTouched;
+  cost.calls +=
+      stats.pixelCalls + stats.rectCalls + stats.lineCalls + stats.textCalls;
+  if (stats.pixelsTouched > cost.maxPixels) {
+    cost.maxPixels = stats.pixelsTouched;
+  }
+  matrix.resetStats();
+}
+
+/**
+ * @brief Picks the column and rotation that put the Tetromino lowest.
+ *
+ * @param target Receives the x-coordinate to drop the Tetromino at.
+ * @param targetRotation Receives the rotation to drop the Tetromino in.
+ */
+static void planDrop(uint8_t& target, uint8_t& targetRotation) {
+  Board& board = game.getBoard();
+  Tetromino& tetromino = game.getCurrentTetromino();
+  int16_t best = -1;
+
+  target = tetromino.getOffsetX();
+  targetRotation = tetromino.getRotation();
+
+  for (uint8_t rotation = 0; rotation < 4; rotation++) {
+    TetrominoShape shape = Tetromino::getShape(tetromino.getType(), rotation);
+
+    for (int8_t column = -shape.left; column + shape.right < Board::WIDTH;
+         column++) {
+      int16_t x = Board::OFFSET_X + column * Board::SCALE;
+      // Shapes whose first occupied column is 2 or more can reach the left
+      // wall only with the offset left of the display edge. nextKey compares
+      // unsigned offsets, so the autopilot skips those placements.
+      if (x < 0) {
+        continue;
+      }
+
+      int16_t bottom =
+          Board::toRow(board.getLandingY(tetromino, x, rotation)) +
+          shape.bottom;
+
+      if (bottom > best) {
+        best = bottom;
+        target = x;
+        targetRotation = rotation;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Chooses the next autopilot key for the current Tetromino.
+ */
+static char nextKey(uint8_t target, uint8_t targetRotation) {
+  Tetromino& tetromino = game.getCurrentTetromino();
+
+  if (tetromino.getRotation() != targetRotation) {
+    return '5';
+  }
+  if (tetromino.getOffsetX() > target) {
+    return '6';
+  }
+  if (tetromino.getOffsetX() < target) {
+    return '4';
+  }
+  return '2';
+}
+
+/**
+ * @brief Prints the collected costs as a table.
+ */
+static void printCosts() {
+  printf("%-12s %8s %12s %12s %10s\n", "event", "count", "pixels/event",
+         "calls/event", "max pixels");
+
+  for (uint8_t event = 0; event < NUM_EVENTS; event++) {
+    const EventCost& cost = costs[event];
+
+    if (cost.count == 0) {
+      printf("%-12s %8u %12s %12s %10s\n", EVENT_NAMES[event], 0u, "-", "-",
+             "-");
+      continue;
+    }
+    printf("%-12s %8u %12.1f %12.1f %10u\n", EVENT_NAMES[event], cost.count,
+           double(cost.pixels) / cost.count, double(cost.calls) / cost.count,
+           cost.maxPixels);
+  }
+}
+
+/**
+ * @brief Prints the work of the board's shadow buffer since startup.
+ *
+ * A renderer drawing cell by cell would have issued one draw call per
+ * changed cell; the spans merge runs of them into fewer calls.
+ */
+static void printShadowCosts() {
+  const Board::ShadowBufferType& shadow = Board::getShadow();
+  uint32_t cells = shadow.getChangedCells();
+  uint32_t calls = shadow.getDrawCalls();
+
+  printf("board shadow: %u pixels written, %u cells changed, %u draw calls",
+         shadow.getPixelWrites(), cells, calls);
+  if (calls > 0) {
+    printf(", %.2f cells per call", double(cells) / calls);
+  }
+  printf("\n");
+}
+
+/**
+ * @brief Ends an occurrence of an event and books its panel work.
+ *
+ * With a dump directory, the panel is written as an image after the first
+ * occurrence of every event.
+ *
+ * @param event The event that ended.
+ * @param dumpDirectory The directory for images, or nullptr for none.
+ */
+static void endEvent(RenderEvent event, const char* dumpDirectory) {
+  static bool dumped[NUM_EVENTS];
+
+  if (dumpDirectory && !dumped[event]) {
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s.ppm", dumpDirectory,
+             EVENT_NAMES[event]);
+    matrix.dumpPPM(path);
+    dumped[event] = true;
+  }
+  bookCost(event, 1);
+}
+
+int main(int argc, char** argv) {
+  uint16_t games = argc > 1 ? atoi(argv[1]) : RENDER_COST_GAMES;
+  const char* dumpDirectory = argc > 2 ? argv[2] : nullptr;
+
+  setup();
+  hostPressKey('A');
+  while (app.getState() == APP_TITLE) {
+    loop();
+    hostAdvanceMicros(RENDER_COST_LOOP_TIME);
+  }
+  matrix.resetStats();
+
+  RenderEvent event = IDLE_EVENT;
+  unsigned long eventEnd = 0;
+  unsigned long idleMicros = 0;
+  unsigned long nextKeyTime = 0;
+  unsigned long nextPauseTime = RENDER_COST_PAUSE_INTERVAL;
+  bool paused = false;
+  const Tetromino* lastTetromino = &game.getCurrentTetromino();
+  uint8_t target = 0;
+  uint8_t targetRotation = 0;
+  uint16_t gamesPlayed = 0;
+
+  planDrop(target, targetRotation);
+
+  while (gamesPlayed < games) {
+    unsigned long now = millis();
+    bool wasOver = game.isGameOver();
+    RenderEvent newEvent = IDLE_EVENT;
+
+    // Keys are pressed no faster than the sketch polls them, so none pile up
+    if (wasOver) {
+      if (now >= nextKeyTime) {
+        hostPressKey('C');
+        nextKeyTime = now + RENDER_COST_KEY_INTERVAL;
+      }
+    } else if (now >= nextPauseTime) {
+      hostPressKey('B');
+      newEvent = paused ? UNPAUSE_EVENT : PAUSE_EVENT;
+      paused = !paused;
+      nextPauseTime =
+          now + (paused ? RENDER_COST_PAUSE_TIME : RENDER_COST_PAUSE_INTERVAL);
+    } else if (!paused && now >= nextKeyTime) {
+      hostPressKey(nextKey(target, targetRotation));
+      nextKeyTime = now + RENDER_COST_KEY_INTERVAL;
+    }
+
+    // Input events start before the loop iteration that handles them
+    if (newEvent != IDLE_EVENT) {
+      if (event != IDLE_EVENT) {
+        endEvent(event, dumpDirectory);
+      }
+      event = newEvent;
+      eventEnd = now + EVENT_WINDOWS[event];
+      newEvent = IDLE_EVENT;
+    }
+
+    loop();
+    hostAdvanceMicros(RENDER_COST_LOOP_TIME);
+
+    // A new current Tetromino means the last one was locked, unless a new
+    // game started
+    const Tetromino* tetromino = &game.getCurrentTetromino();
+    if (game.isGameOver()) {
+      if (!wasOver) {
+        newEvent = GAME_OVER_EVENT;
+        gamesPlayed++;
+      }
+    } else if (tetromino != lastTetromino) {
+      if (!wasOver) {
+        newEvent = game.getBoard().getClearedRows() != 0 ? LINE_CLEAR_EVENT
+                                                         : LOCK_EVENT;
+      }
+      lastTetromino = tetromino;
+      planDrop(target, targetRotation);
+    }
+
+    // The loop iteration that caused an event belongs to the event; a new
+    // event ends the window of the previous one early
+    if (newEvent != IDLE_EVENT) {
+      if (event != IDLE_EVENT) {
+        endEvent(event, dumpDirectory);
+      }
+      event = newEvent;
+      eventEnd = now + EVENT_WINDOWS[event];
+    } else if (event == GAME_OVER_EVENT && wasOver) {
+      eventEnd = now + EVENT_WINDOWS[event];
+    } else if (event != IDLE_EVENT && now >= eventEnd) {
+      endEvent(event, dumpDirectory);
+      event = IDLE_EVENT;
+    }
+
+    if (event == IDLE_EVENT) {
+      idleMicros += RENDER_COST_LOOP_TIME;
+      bookCost(IDLE_EVENT, 0);
+    }
+  }
+
+  if (event != IDLE_EVENT) {
+    endEvent(event, dumpDirectory);
+  }
+  costs[IDLE_EVENT].count = idleMicros / 1000 / FRAME_INTERVAL;
+
+  printf("%u games, %lu s simulated\n", gamesPlayed, millis() / 1000);
+  printCosts();
+  printShadowCosts();
+  return 0;
+}
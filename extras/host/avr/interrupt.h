@@ -0,0 +1,12 @@
+#ifndef HOST_AVR_INTERRUPT_H
+#define HOST_AVR_INTERRUPT_H
+
+/**
+ * @brief Host replacement for the AVR interrupt vectors.
+ *
+ * An interrupt handler becomes a plain function named after its vector, which
+ * a host program calls to simulate the interrupt.
+ */
+#define ISR(vector, ...) extern "C" void vector()
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef HOST_AVR_IO_H
+#define HOST_AVR_IO_H
+
+#include <stdint.h>
+
+/**
+ * @brief Host replacement for the AVR registers the panel driver uses.
+ *
+ * The registers are plain variables, so code that writes them directly
+ * builds and runs on the host. Writing them has no effect beyond that, except
+ * that PORTA records its values, so a host program can read back the color
+ * data a panel driver shifts out.
+ */
+
+#define _BV(bit) (1 << (bit))
+
+#define WGM12 3
+#define CS10 0
+#define OCIE1A 1
+
+/**
+ * @brief Number of values a HostPort records.
+ */
+#define HOST_PORT_LOG 256
+
+/**
+ * @brief An output port that records the values written to it.
+ */
+class HostPort {
+ private:
+  uint8_t value;               ///< Current value of the port.
+  uint8_t log[HOST_PORT_LOG];  ///< Values written since the last clear.
+  uint16_t writes;             ///< Values written since the last clear.
+
+ public:
+  HostPort& operator=(uint8_t newValue);
+  HostPort& operator|=(uint8_t bits);
+  HostPort& operator&=(uint8_t bits);
+  operator uint8_t() const;
+
+  /**
+   * @brief Forgets the recorded values (host only).
+   */
+  void clearLog();
+
+  /**
+   * @brief Retrieves the number of recorded values (host only).
+   *
+   * @return The number of values written since the last clear, at most
+   * HOST_PORT_LOG.
+   */
+  uint16_t getWrites() const;
+
+  /**
+   * @brief Retrieves a recorded value (host only).
+   *
+   * @param index The index of the write since the last clear.
+   * @return The value written.
+   */
+  uint8_t getWrite(uint16_t index) const;
+};
+
+extern HostPort PORTA;
+extern volatile uint8_t DDRA;
+
+extern volatile uint8_t TCCR1A;
+extern volatile uint8_t TCCR1B;
+extern volatile uint8_t TIMSK1;
+extern volatile uint16_t OCR1A;
+extern volatile uint16_t TCNT1;
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef HOST_AVR_PGMSPACE_H
+#define HOST_AVR_PGMSPACE_H
+
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @brief Host replacement for the AVR program memory helpers.
+ *
+ * The host has a single address space, so program memory is plain constant
+ * data. pgm_read_word reads the whole pointee instead of 16 bits, because the
+ * sketch also uses it for tables of pointers, which are wider than 16 bits
+ * on the host.
+ */
+#define PROGMEM
+#define PSTR(string) (string)
+
+#define pgm_read_byte(address) (*reinterpret_cast<const uint8_t*>(address))
+#define pgm_read_word(address) (*(address))
+#define pgm_read_dword(address) (*reinterpret_cast<const uint32_t*>(address))
+#define pgm_read_qword(address) (*reinterpret_cast<const uint64_t*>(address))
+
+#define memcpy_P memcpy
+#define strlen_P strlen
+
+#endif
@@ -0,0 +1,11 @@
+#ifndef HOST_FALLBACK_FREE_MONO_BOLD_9PT7B_H
+#define HOST_FALLBACK_FREE_MONO_BOLD_9PT7B_H
+
+/**
+ * @brief Empty stand-in for the FreeMonoBold9pt7b font of Adafruit_GFX.
+ *
+ * Has no glyphs, so text in this font is counted but not drawn.
+ */
+const GFXfont FreeMonoBold9pt7b = {nullptr, nullptr, 0x20, 0x1F, 18};
+
+#endif
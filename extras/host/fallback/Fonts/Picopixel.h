@@ -0,0 +1,11 @@
+#ifndef HOST_FALLBACK_PICOPIXEL_H
+#define HOST_FALLBACK_PICOPIXEL_H
+
+/**
+ * @brief Empty stand-in for the Picopixel font of Adafruit_GFX.
+ *
+ * Has no glyphs, so text in this font is counted but not drawn.
+ */
+const GFXfont Picopixel = {nullptr, nullptr, 0x20, 0x1F, 7};
+
+#endif
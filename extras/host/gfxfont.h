@@ -0,0 +1,36 @@
+#ifndef _GFXFONT_H_
+#define _GFXFONT_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Font structures in the layout of the Adafruit_GFX library.
+ *
+ * The header guard matches the library's gfxfont.h, so the font headers of
+ * an Adafruit_GFX checkout can be used on the host as they are.
+ */
+
+/**
+ * @brief Position and metrics of one character in a font bitmap.
+ */
+typedef struct {
+  uint16_t bitmapOffset;  ///< Offset of the glyph in the font bitmap.
+  uint8_t width;          ///< Bitmap width in pixels.
+  uint8_t height;         ///< Bitmap height in pixels.
+  uint8_t xAdvance;       ///< Distance to the next cursor position.
+  int8_t xOffset;         ///< X distance from the cursor to the bitmap.
+  int8_t yOffset;         ///< Y distance from the baseline to the bitmap.
+} GFXglyph;
+
+/**
+ * @brief A proportional font.
+ */
+typedef struct {
+  uint8_t* bitmap;   ///< Concatenated glyph bitmaps.
+  GFXglyph* glyph;   ///< Glyph metrics, from first to last.
+  uint16_t first;    ///< First character in the font.
+  uint16_t last;     ///< Last character in the font.
+  uint8_t yAdvance;  ///< Line height in pixels.
+} GFXfont;
+
+#endif
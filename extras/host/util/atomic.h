@@ -0,0 +1,14 @@
+#ifndef HOST_UTIL_ATOMIC_H
+#define HOST_UTIL_ATOMIC_H
+
+/**
+ * @brief Host replacement for the AVR atomic blocks.
+ *
+ * Interrupts are simulated by plain calls on the host, so the block only
+ * runs its body once.
+ */
+#define ATOMIC_RESTORESTATE
+#define ATOMIC_BLOCK(type) \
+  for (bool hostAtomicOnce = true; hostAtomicOnce; hostAtomicOnce = false)
+
+#endif
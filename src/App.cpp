@@ -0,0 +1,114 @@
+#include "App.h"
+
+#include "Profiler.h"
+
+/**
+ * @brief Constructor for the App class.
+ *
+ * @param game The game to run.
+ */
+App::App(Game& game) : game(game), state(APP_TITLE) {}
+
+/**
+ * @brief Handles a key press in the current state.
+ *
+ * A starts the first game on the title screen and C a new one after a game
+ * over, without waiting for anything. While playing, every key goes to the
+ * game; while paused, only B to resume. With the profiler enabled,
+ * PROFILER_DUMP_KEY dumps its results in every state.
+ *
+ * @param key The character of the pressed key.
+ */
+void App::handleKey(char key) {
+#if PROFILER_ENABLED
+  if (key == PROFILER_DUMP_KEY) {
+    PROFILER_DUMP();
+    return;
+  }
+#endif
+
+  // The volume keys bypass keyAction, which needs a running game
+  if (key == '#') {
+    game.volumeUp();
+    return;
+  }
+  if (key == '*') {
+    game.volumeDown();
+    return;
+  }
+
+  switch (state) {
+    case APP_TITLE:
+      if (key == 'A') {
+        game.init();
+        state = APP_PLAYING;
+      }
+      break;
+    case APP_PLAYING:
+      game.keyAction(key);
+      if (key == 'B') {
+        state = APP_PAUSED;
+      }
+      break;
+    case APP_PAUSED:
+      if (key == 'B') {
+        game.togglePause();
+        state = APP_PLAYING;
+      }
+      break;
+    case APP_GAME_OVER:
+      if (key == 'C') {
+        game.resetGame();
+        game.init();
+        state = APP_PLAYING;
+      }
+      break;
+  }
+}
+
+/**
+ * @brief Advances the game by one logic tick while playing.
+ */
+void App::tick() {
+  if (state != APP_PLAYING) {
+    return;
+  }
+
+  game.run();
+  if (game.isGameOver()) {
+    state = APP_GAME_OVER;
+  }
+}
+
+/**
+ * @brief Steps the sound effects, including the game-over sound.
+ */
+void App::updateSounds() { game.updateSounds(); }
+
+/**
+ * @brief Keeps the background music playing during a game.
+ *
+ * The music is stopped on the game over screen and not started yet on the
+ * title screen.
+ */
+void App::pollPlayer() {
+  if (state == APP_PLAYING || state == APP_PAUSED) {
+    game.pollPlayer();
+  }
+}
+
+/**
+ * @brief Renders the game while playing.
+ */
+void App::render() {
+  if (state == APP_PLAYING) {
+    game.render();
+  }
+}
+
+/**
+ * @brief Retrieves the current state.
+ *
+ * @return The current state.
+ */
+AppState App::getState() const { return state; }
@@ -0,0 +1,79 @@
+#ifndef APP_H
+#define APP_H
+
+#include "Game.h"
+
+/**
+ * @brief States of the front end.
+ */
+enum AppState {
+  APP_TITLE,      ///< The title screen waits for A to start.
+  APP_PLAYING,    ///< A game is running.
+  APP_PAUSED,     ///< The game is paused, the pause screen is shown.
+  APP_GAME_OVER,  ///< The game over screen waits for C to restart.
+};
+
+/**
+ * @brief The App class runs the front end as a state machine.
+ *
+ * Routes keys, logic ticks, sounds and frames to the game depending on the
+ * current state. No state waits for anything: every method returns right
+ * away, so the scheduler keeps running all tasks on every screen.
+ */
+class App {
+ private:
+  Game& game;      ///< The game shown while playing.
+  AppState state;  ///< The current state.
+
+ public:
+  /**
+   * @brief Constructor for the App class.
+   *
+   * Starts on the title screen.
+   *
+   * @param game The game to run.
+   */
+  App(Game& game);
+
+  /**
+   * @brief Handles a key press in the current state.
+   *
+   * The volume keys work in every state.
+   *
+   * @param key The character of the pressed key.
+   */
+  void handleKey(char key);
+
+  /**
+   * @brief Advances the game by one logic tick while playing.
+   *
+   * Switches to the game over state when the game ended.
+   */
+  void tick();
+
+  /**
+   * @brief Steps the sound effects, including the game-over sound.
+   */
+  void updateSounds();
+
+  /**
+   * @brief Keeps the background music playing during a game.
+   */
+  void pollPlayer();
+
+  /**
+   * @brief Renders the game while playing.
+   *
+   * The other screens are static and drawn when their state is entered.
+   */
+  void render();
+
+  /**
+   * @brief Retrieves the current state.
+   *
+   * @return The current state.
+   */
+  AppState getState() const;
+};
+
+#endif
@@ -1,85 +1,84 @@
 #include "Board.h"
 
 #include "Display.h"
+#include "Profiler.h"
 #include "Tetromino.h"
 
 /**
- * @brief Constructor of the Board class.
+ * @brief Constructor of the BasicBoard class.
  *
  * Initializes the playing field by setting all cells to empty (0).
  */
-Board::Board() {
-  for (uint8_t y = 0; y < BOARD_HEIGHT; y++) {
-    for (uint8_t x = 0; x < (BOARD_WIDTH + 1) / 2; x++) {
-      field[y][x] = 0;
-    }
-  }
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY, typename Packing>
+BasicBoard<Width, Height, Scale, OffsetX, OffsetY, Packing>::BasicBoard() {
+  clear();
 }
 
 /**
- * @brief Destructor of the Board class.
+ * @brief Destructor of the BasicBoard class.
  *
  * Currently, it does not perform any actions since no dynamic memory is used.
  */
-Board::~Board() {}
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY, typename Packing>
+BasicBoard<Width, Height, Scale, OffsetX, OffsetY, Packing>::~BasicBoard() {}
 
 /**
  * @brief Computes the bit index for a given x-coordinate.
  *
- * Each horizontal cell in the field is represented by 3 bits. This method
- * calculates the starting bit index for the specified cell.
+ * Each horizontal cell in the field is represented by Packing::BITS bits.
+ * This method calculates the starting bit index for the specified cell.
  *
  * @param x The x-coordinate of the cell.
  * @return The bit index for the cell.
  */
-uint16_t Board::getBitIndex(uint8_t x) const { return x * 3; }
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY, typename Packing>
+uint16_t
+BasicBoard<Width, Height, Scale, OffsetX, OffsetY, Packing>::getBitIndex(
+    uint8_t x) const {
+  return x * Packing::BITS;
+}
 
 /**
  * @brief Retrieves the Tetromino type at a specific position on the board.
  *
- * This method extracts the 3 bits representing the Tetromino type stored at
- * the specified coordinates.
+ * This method unpacks the Tetromino type stored at the specified coordinates
+ * using the board's packing policy.
  *
  * @param x The x-coordinate of the cell.
  * @param y The y-coordinate of the cell.
  * @return The TetrominoType at the given coordinates, or NO_TETRO if empty.
  */
-TetrominoType Board::getFieldType(uint8_t x, uint8_t y) const {
-  uint16_t bitIndex = getBitIndex(x);
-  uint16_t byteIndex = bitIndex / 8;
-  uint8_t bitOffset = bitIndex % 8;
-
-  uint8_t value = (field[y][byteIndex] >> bitOffset) & 0b111;
-
-  if (bitOffset > 5) {
-    value |= (field[y][byteIndex + 1] << (8 - bitOffset)) & 0b111;
-  }
-
-  return static_cast<TetrominoType>(value);
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY, typename Packing>
+TetrominoType
+BasicBoard<Width, Height, Scale, OffsetX, OffsetY, Packing>::getFieldType(
+    uint8_t x, uint8_t y) const {
+  return static_cast<TetrominoType>(Packing::get(field[y], x));
 }
 
 /**
  * @brief Sets the Tetromino type at a specific position on the board.
  *
- * Updates the 3 bits at the specified coordinates to store the given
- * TetrominoType.
+ * Packs the given TetrominoType into the cell at the specified coordinates
+ * and keeps the occupancy bitboard in sync.
  *
  * @param x The x-coordinate of the cell.
  * @param y The y-coordinate of the cell.
  * @param type The TetrominoType to be stored at the given position.
  */
-void Board::setField(uint8_t x, uint8_t y, TetrominoType type) {
-  uint16_t bitIndex = getBitIndex(x);
-  uint16_t byteIndex = bitIndex / 8;
-  uint8_t bitOffset = bitIndex % 8;
-
-  field[y][byteIndex] &= ~(((1 << 3) - 1) << bitOffset);
-  field[y][byteIndex] |= (static_cast<uint8_t>(type) & 0b111) << bitOffset;
-
-  if (bitOffset > 5) {
-    field[y][byteIndex + 1] &= ~((1 << (bitOffset - 5)) - 1);
-    field[y][byteIndex + 1] |=
-        (static_cast<uint8_t>(type) & 0b111) >> (8 - bitOffset);
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY, typename Packing>
+void BasicBoard<Width, Height, Scale, OffsetX, OffsetY, Packing>::setField(
+    uint8_t x, uint8_t y, TetrominoType type) {
+  Packing::set(field[y], x, type);
+
+  if (type != NO_TETRO) {
+    rowMask[y] |= static_cast<RowMask>(1) << x;
+  } else {
+    rowMask[y] &= ~(static_cast<RowMask>(1) << x);
   }
 }
 
@@ -87,32 +86,41 @@ void Board::setField(uint8_t x, uint8_t y, TetrominoType type) {
  * @brief Places a Tetromino on the board and renders it on the display.
  *
  * Sets the cells of the board to the Tetromino type and visually draws the
- * Tetromino on the LED matrix display.
+ * Tetromino on the LED matrix display. Raises the column heights under the
+ * Tetromino and extends the range of rows that clearFullLines has to inspect.
  *
  * @param tetromino The Tetromino object to place on the board.
  */
-void Board::placeTetromino(const Tetromino& tetromino) {
-  uint8_t boardX = tetromino.getOffsetX() - BOARD_OFFSET_X;
-  uint8_t boardY = tetromino.getOffsetY() - BOARD_OFFSET_Y;
-
-  uint64_t shape =
-      pgm_read_qword(&(TETROMINOES[tetromino.type - 1][tetromino.rotation]));
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY, typename Packing>
+void
+BasicBoard<Width, Height, Scale, OffsetX, OffsetY, Packing>::placeTetromino(
+    const Tetromino& tetromino) {
+  uint8_t boardX = toColumn(tetromino.getOffsetX());
+  uint8_t boardY = toRow(tetromino.getOffsetY());
+
+  uint16_t mask = Tetromino::getShape(tetromino.type, tetromino.rotation).mask;
   TetrominoType type = tetromino.type;
+  Colors color = Tetromino::getColorIndex(type);
 
-  for (uint8_t i = 0; i < 64; i++) {
-    if (shape & (1ULL << i)) {
-      uint8_t row = i / 8;
-      uint8_t col = i % 8;
+  for (uint8_t cell = 0; mask != 0; cell++, mask >>= 1) {
+    if (mask & 1) {
+      uint8_t fieldX = boardX + cell % 4;
+      uint8_t fieldY = boardY + cell / 4;
 
-      uint8_t fieldX = boardX + col;
-      uint8_t fieldY = boardY + row;
+      if (fieldX < Width && fieldY < Height) {
+        if (fieldY < placedTop) {
+          placedTop = fieldY;
+        }
+        if (fieldY > placedBottom) {
+          placedBottom = fieldY;
+        }
+        if (columnHeight[fieldX] < Height - fieldY) {
+          columnHeight[fieldX] = Height - fieldY;
+        }
 
-      if (fieldX < BOARD_WIDTH && fieldY < BOARD_HEIGHT) {
         setField(fieldX, fieldY, type);
-
-        uint16_t color = Tetromino::getColor(type);
-        matrix.drawPixel(fieldX + BOARD_OFFSET_X, fieldY + BOARD_OFFSET_Y,
-                         color);
+        drawCell(fieldX, fieldY, color);
       }
     }
   }
@@ -124,36 +132,121 @@ void Board::placeTetromino(const Tetromino& tetromino) {
  * Iterates over each cell on the board and draws the corresponding color
  * on the LED matrix. Empty cells are drawn as black.
  */
-void Board::draw() {
-  for (uint8_t y = 0; y < BOARD_HEIGHT; y++) {
-    for (uint8_t x = 0; x < BOARD_WIDTH; x++) {
-      TetrominoType type = getFieldType(x, y);
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY, typename Packing>
+void BasicBoard<Width, Height, Scale, OffsetX, OffsetY, Packing>::draw() {
+  drawRows(0, Height - 1);
+}
 
-      matrix.drawPixel(x + BOARD_OFFSET_X, y + BOARD_OFFSET_Y,
-                       type != NO_TETRO ? Tetromino::getColor(type)
-                                        : Display::getColor(BLACK));
+/**
+ * @brief Renders a range of rows into the shadow buffer.
+ *
+ * Draws the color of every cell in the given rows. Empty cells are drawn as
+ * black.
+ *
+ * @param firstRow The first row to draw.
+ * @param lastRow The last row to draw.
+ */
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY, typename Packing>
+void BasicBoard<Width, Height, Scale, OffsetX, OffsetY, Packing>::drawRows(
+    uint8_t firstRow, uint8_t lastRow) {
+  for (uint8_t y = firstRow; y <= lastRow; y++) {
+    for (uint8_t x = 0; x < Width; x++) {
+      drawCell(x, y, Tetromino::getColorIndex(getFieldType(x, y)));
     }
   }
 }
 
+/**
+ * @brief Renders a single cell into the shadow buffer.
+ *
+ * The shadow buffer scales the cell to a block of Scale x Scale pixels at the
+ * board's position on the LED matrix when it is flushed.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @param color The palette color to draw the cell in.
+ */
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY, typename Packing>
+void BasicBoard<Width, Height, Scale, OffsetX, OffsetY, Packing>::drawCell(
+    uint8_t x, uint8_t y, Colors color) {
+  shadow.setCell(x, y, color);
+}
+
+/**
+ * @brief Provides the shadow buffer of the board region.
+ *
+ * @return The shadow buffer that board rendering goes to.
+ */
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY, typename Packing>
+typename BasicBoard<Width, Height, Scale, OffsetX, OffsetY,
+                    Packing>::ShadowBufferType&
+BasicBoard<Width, Height, Scale, OffsetX, OffsetY, Packing>::getShadow() {
+  return shadow;
+}
+
 /**
  * @brief Clears the board by resetting all cells to empty.
  *
- * Updates the internal field array and clears the display for all cells.
+ * Updates the internal field array, the occupancy bitboard and the column
+ * heights, and blanks the board region in the shadow buffer.
  */
-void Board::clear() {
-  for (uint8_t y = 0; y < BOARD_HEIGHT; y++) {
-    for (uint8_t x = 0; x < (BOARD_WIDTH + 1) / 2; x++) {
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY, typename Packing>
+void BasicBoard<Width, Height, Scale, OffsetX, OffsetY, Packing>::clear() {
+  for (uint8_t y = 0; y < Height; y++) {
+    for (uint8_t x = 0; x < sizeof(field[y]); x++) {
       field[y][x] = 0;
     }
+    rowMask[y] = 0;
+  }
+  for (uint8_t x = 0; x < Width; x++) {
+    columnHeight[x] = 0;
   }
+  placedTop = Height;
+  placedBottom = 0;
+  lastClearedRows = 0;
+
+  draw();
+}
+
+/**
+ * @brief Converts a display x-coordinate into a board column.
+ *
+ * @param x The x-coordinate on the display.
+ * @return The board column, negative left of the board.
+ */
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY, typename Packing>
+int8_t
+BasicBoard<Width, Height, Scale, OffsetX, OffsetY, Packing>::toColumn(
+    uint8_t x) {
+  return (static_cast<int8_t>(x) - OffsetX) / Scale;
+}
+
+/**
+ * @brief Converts a display y-coordinate into a board row.
+ *
+ * @param y The y-coordinate on the display.
+ * @return The board row, negative above the board.
+ */
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY, typename Packing>
+int8_t
+BasicBoard<Width, Height, Scale, OffsetX, OffsetY, Packing>::toRow(uint8_t y) {
+  return (static_cast<int8_t>(y) - OffsetY) / Scale;
 }
 
 /**
  * @brief Checks for collisions when moving or rotating a Tetromino.
  *
  * Evaluates if the Tetromino, when placed at the specified position and
- * rotation, would overlap with existing cells or exceed board boundaries.
+ * rotation, would overlap with existing cells or exceed board boundaries. The
+ * walls are checked against the precomputed bounding box of the shape, and
+ * only the occupied rows are tested against the occupancy bitboard.
  *
  * @param tetromino The Tetromino object to test.
  * @param targetX The target x-coordinate.
@@ -161,27 +254,32 @@ void Board::clear() {
  * @param targetRotation The target rotation index.
  * @return True if a collision occurs, otherwise false.
  */
-bool Board::checkCollision(const Tetromino& tetromino, uint8_t targetX,
-                           uint8_t targetY, uint8_t targetRotation) {
-  uint8_t boardX = targetX - BOARD_OFFSET_X;
-  uint8_t boardY = targetY - BOARD_OFFSET_Y;
-  uint64_t shape =
-      pgm_read_qword(&(TETROMINOES[tetromino.type - 1][targetRotation]));
-
-  for (uint8_t i = 0; i < 64; i++) {
-    if (shape & (1ULL << i)) {
-      uint8_t row = i / 8;
-      uint8_t col = i % 8;
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY, typename Packing>
+bool
+BasicBoard<Width, Height, Scale, OffsetX, OffsetY, Packing>::checkCollision(
+    const Tetromino& tetromino, uint8_t targetX, uint8_t targetY,
+    uint8_t targetRotation) {
+  PROFILE_SCOPE(PROFILE_COLLISION);
+
+  TetrominoShape shape = Tetromino::getShape(tetromino.type, targetRotation);
+
+  int8_t left = toColumn(targetX) + shape.left;
+  int8_t right = toColumn(targetX) + shape.right;
+  int8_t top = toRow(targetY) + shape.top;
+  int8_t bottom = toRow(targetY) + shape.bottom;
+
+  if (left < 0 || right >= Width || top < 0 || bottom >= Height) {
+    return true;
+  }
 
-      uint8_t fieldX = boardX + col;
-      uint8_t fieldY = boardY + row;
+  uint8_t fieldY = top;
+  for (uint8_t row = shape.top; row <= shape.bottom; row++, fieldY++) {
+    uint8_t cells = (shape.mask >> (row * 4)) & 0x0F;
+    RowMask bits = static_cast<RowMask>(cells >> shape.left) << left;
 
-      if (fieldX >= BOARD_WIDTH || fieldY >= BOARD_HEIGHT) {
-        return true;
-      }
-      if (getFieldType(fieldX, fieldY) != NO_TETRO) {
-        return true;
-      }
+    if (rowMask[fieldY] & bits) {
+      return true;
     }
   }
 
@@ -191,54 +289,160 @@ bool Board::checkCollision(const Tetromino& tetromino, uint8_t targetX,
 /**
  * @brief Clears complete lines and shifts rows above them downward.
  *
- * Iterates through the board to detect full rows, removes them, and shifts
- * rows above downward. Updates the display for all affected cells.
+ * Only the rows touched by the last placed Tetromino can have become full, so
+ * just those rows are tested against the occupancy bitboard. All surviving
+ * rows above the lowest full row are then compacted in a single pass, so each
+ * row moves at most once regardless of how many lines were cleared. The
+ * cleared rows are recorded so the caller can animate them before redrawing.
  *
  * @return The number of cleared rows.
  */
-uint8_t Board::clearFullLines() {
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY, typename Packing>
+uint8_t
+BasicBoard<Width, Height, Scale, OffsetX, OffsetY, Packing>::clearFullLines() {
   uint8_t clearedRows = 0;
+  uint8_t lowestFullRow = 0;
+
+  lastClearedRows = 0;
+  for (uint8_t y = placedTop; y <= placedBottom; y++) {
+    if (rowMask[y] == FULL_ROW) {
+      clearedRows++;
+      lowestFullRow = y;
+      lastClearedRows |= 1UL << y;
+    }
+  }
 
-  for (uint8_t y = 0; y < BOARD_HEIGHT; y += 2) {
-    bool isFull = true;
+  placedTop = Height;
+  placedBottom = 0;
 
-    for (uint8_t x = 0; x < BOARD_WIDTH; x++) {
-      if (getFieldType(x, y) == NO_TETRO ||
-          getFieldType(x, y + 1) == NO_TETRO) {
-        isFull = false;
-        break;
-      }
+  if (clearedRows == 0) {
+    return 0;
+  }
+
+  int8_t targetRow = lowestFullRow;
+  for (int8_t row = lowestFullRow; row >= 0; row--) {
+    if (rowMask[row] == FULL_ROW) {
+      continue;
+    }
+    if (targetRow != row) {
+      memcpy(field[targetRow], field[row], sizeof(field[0]));
+      rowMask[targetRow] = rowMask[row];
     }
+    targetRow--;
+  }
 
-    if (isFull) {
-      clearedRows++;
-      for (uint8_t row = y; row > 1; row -= 2) {
-        for (uint8_t x = 0; x < BOARD_WIDTH; x++) {
-          setField(x, row, getFieldType(x, row - 2));
-          setField(x, row + 1, getFieldType(x, row - 1));
-
-          matrix.drawPixel(x + BOARD_OFFSET_X, row + BOARD_OFFSET_Y,
-                           getFieldType(x, row) != NO_TETRO
-                               ? Tetromino::getColor(getFieldType(x, row))
-                               : Display::getColor(BLACK));
-          matrix.drawPixel(x + BOARD_OFFSET_X, row + 1 + BOARD_OFFSET_Y,
-                           getFieldType(x, row + 1) != NO_TETRO
-                               ? Tetromino::getColor(getFieldType(x, row + 1))
-                               : Display::getColor(BLACK));
-        }
-      }
+  for (; targetRow >= 0; targetRow--) {
+    memset(field[targetRow], 0, sizeof(field[0]));
+    rowMask[targetRow] = 0;
+  }
+
+  updateColumnHeights();
+
+  return clearedRows;
+}
+
+/**
+ * @brief Retrieves the rows removed by the last call to clearFullLines.
+ *
+ * @return A mask with bit y set for every cleared row y, counted before the
+ *         rows above moved down.
+ */
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY, typename Packing>
+uint32_t
+BasicBoard<Width, Height, Scale, OffsetX, OffsetY, Packing>::getClearedRows()
+    const {
+  return lastClearedRows;
+}
+
+/**
+ * @brief Recomputes the column heights from the occupancy bitboard.
+ *
+ * Scans the rows from the top and assigns each column the height of the first
+ * row in which it is occupied. The scan stops as soon as every column has been
+ * found.
+ */
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY, typename Packing>
+void BasicBoard<Width, Height, Scale, OffsetX, OffsetY,
+                Packing>::updateColumnHeights() {
+  RowMask pending = FULL_ROW;
+
+  for (uint8_t x = 0; x < Width; x++) {
+    columnHeight[x] = 0;
+  }
 
-      for (uint8_t x = 0; x < BOARD_WIDTH; x++) {
-        setField(x, 0, NO_TETRO);
-        setField(x, 1, NO_TETRO);
+  for (uint8_t y = 0; y < Height && pending != 0; y++) {
+    RowMask found = rowMask[y] & pending;
+    pending &= ~found;
 
-        matrix.drawPixel(x + BOARD_OFFSET_X, 0 + BOARD_OFFSET_Y,
-                         Display::getColor(BLACK));
-        matrix.drawPixel(x + BOARD_OFFSET_X, 1 + BOARD_OFFSET_Y,
-                         Display::getColor(BLACK));
+    for (uint8_t x = 0; found != 0; x++, found >>= 1) {
+      if (found & 1) {
+        columnHeight[x] = Height - y;
       }
-      y -= 2;
     }
   }
-  return clearedRows;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Computes where a Tetromino comes to rest when dropped.
+ *
+ * For every occupied column of the shape, the lowest cell is compared with the
+ * height of the board column below it. The column that stops the Tetromino
+ * first determines the landing position.
+ *
+ * @param tetromino The Tetromino to drop.
+ * @param targetX The x-coordinate to drop the Tetromino at.
+ * @param targetRotation The rotation index to drop the Tetromino in.
+ * @return The y-coordinate at which the Tetromino lands.
+ */
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY, typename Packing>
+uint8_t
+BasicBoard<Width, Height, Scale, OffsetX, OffsetY, Packing>::getLandingY(
+    const Tetromino& tetromino, uint8_t targetX, uint8_t targetRotation) const {
+  TetrominoShape shape = Tetromino::getShape(tetromino.type, targetRotation);
+  int8_t boardX = toColumn(targetX);
+  int8_t landingY = Height;
+
+  for (uint8_t col = shape.left; col <= shape.right; col++) {
+    if (!(shape.mask & (0x1111 << col))) {
+      continue;
+    }
+
+    uint8_t bottom = shape.bottom;
+    while (!(shape.mask & (1 << (bottom * 4 + col)))) {
+      bottom--;
+    }
+
+    int8_t y = Height - columnHeight[boardX + col] - (bottom + 1);
+
+    if (y < landingY) {
+      landingY = y;
+    }
+  }
+
+  return landingY * Scale + OffsetY;
+}
+
+/**
+ * @brief Shadow buffer of the board region.
+ *
+ * Zero-initialized static storage, so it is usable before any constructor
+ * runs.
+ */
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY, typename Packing>
+typename BasicBoard<Width, Height, Scale, OffsetX, OffsetY,
+                    Packing>::ShadowBufferType
+    BasicBoard<Width, Height, Scale, OffsetX, OffsetY, Packing>::shadow;
+
+/**
+ * @brief Instantiation of the board for the configured panel.
+ *
+ * Every board geometry in use needs an explicit instantiation here, since the
+ * member definitions are not visible to other translation units.
+ */
+template class BasicBoard<BOARD_WIDTH, BOARD_HEIGHT, BOARD_SCALE,
+                          BOARD_OFFSET_X, BOARD_OFFSET_Y, BOARD_PACKING>;
@@ -1,7 +1,9 @@
 #ifndef BOARD_H
 #define BOARD_H
 
+#include "CellPacking.h"
 #include "Display.h"
+#include "ShadowBuffer.h"
 #include "Tetromino.h"
 
 /**
@@ -13,50 +15,152 @@
 class Tetromino;
 
 /**
- * @brief Constants defining the dimensions and offsets of the game board.
+ * @brief Selects one of two types at compile time.
+ *
+ * Provides IfTrue as Type when the condition holds and IfFalse otherwise.
  */
-#define BOARD_WIDTH 28
-#define BOARD_HEIGHT 40
-#define BOARD_OFFSET_X 3
-#define BOARD_OFFSET_Y 21
+template <bool Condition, typename IfTrue, typename IfFalse>
+struct SelectType {
+  typedef IfTrue Type;
+};
+
+template <typename IfTrue, typename IfFalse>
+struct SelectType<false, IfTrue, IfFalse> {
+  typedef IfFalse Type;
+};
 
 /**
- * @brief The Board class represents the Tetris game board.
+ * @brief The BasicBoard class template represents a Tetris game board.
  *
  * This class manages the state of the game board, including the placement of
- * Tetromino pieces, collision detection, and clearing of full rows.
+ * Tetromino pieces, collision detection, and clearing of full rows. The
+ * geometry is fixed at compile time, so every configuration gets its own
+ * constant-folded loops, the narrowest row mask that fits its width and a
+ * packed field sized exactly for it. The packing policy decides how many bits
+ * each cell occupies in the field (see CellPacking.h).
+ *
+ * @tparam Width The number of cells per row, at most 32.
+ * @tparam Height The number of rows, at most 32.
+ * @tparam Scale The edge length of a cell in pixels.
+ * @tparam OffsetX The x-coordinate of the board's left edge on the display.
+ * @tparam OffsetY The y-coordinate of the board's top edge on the display.
+ * @tparam Packing The cell packing policy of the field.
  */
-class Board {
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY, typename Packing>
+class BasicBoard {
+  static_assert(Width <= 32, "RowMask holds at most 32 cells per row");
+  static_assert(Height <= 32, "lastClearedRows holds one bit per row");
+
+ public:
+  static const uint8_t WIDTH = Width;                  ///< Cells per row.
+  static const uint8_t HEIGHT = Height;                ///< Number of rows.
+  static const uint8_t SCALE = Scale;                  ///< Cell size in pixels.
+  static const uint8_t OFFSET_X = OffsetX;             ///< Left edge in pixels.
+  static const uint8_t OFFSET_Y = OffsetY;             ///< Top edge in pixels.
+  static const uint8_t PIXEL_WIDTH = Width * Scale;    ///< Width in pixels.
+  static const uint8_t PIXEL_HEIGHT = Height * Scale;  ///< Height in pixels.
+
+  /**
+   * @brief Display position at which new Tetrominos enter the board.
+   *
+   * Centers the 4x4 shape grid horizontally and starts it two cells above the
+   * board, so the occupied bottom rows of the shapes appear at the top.
+   */
+  static const uint8_t SPAWN_X = OffsetX + (Width / 2 - 2) * Scale;
+  static const uint8_t SPAWN_Y = OffsetY - 2 * Scale;
+
+  /**
+   * @brief Occupancy mask type, the narrowest word that holds a full row.
+   */
+  typedef typename SelectType<
+      (Width <= 8), uint8_t,
+      typename SelectType<(Width <= 16), uint16_t, uint32_t>::Type>::Type
+      RowMask;
+
+  /**
+   * @brief Row mask with every cell of a board row occupied.
+   */
+  static const RowMask FULL_ROW = static_cast<RowMask>((1ULL << Width) - 1);
+
+  /**
+   * @brief Shadow buffer type covering the board region of the display.
+   */
+  typedef BasicShadowBuffer<Width, Height, Scale, OffsetX, OffsetY>
+      ShadowBufferType;
+
  private:
   /**
    * @brief A 2D array representing the state of the board.
    *
-   * Each cell stores 3 bits to encode the type of Tetromino present, if any.
-   * The board's width is stored compactly to save memory.
+   * Each cell stores the type of Tetromino present, if any, in Packing::BITS
+   * bits. Rows are padded to whole bytes.
+   */
+  uint8_t field[Height][(Width * Packing::BITS + 7) / 8];
+
+  /**
+   * @brief Occupancy bitboard with one word per row.
+   *
+   * Bit x of rowMask[y] is set when the cell (x, y) holds a Tetromino. It is
+   * kept in sync with field by setField, so collision checks can test a whole
+   * shape row with a single AND instead of unpacking every cell.
+   */
+  RowMask rowMask[Height];
+
+  /**
+   * @brief Off-screen copy of the board region of the display.
+   *
+   * All board rendering goes through drawCell into this buffer. It is shared
+   * by every board of this geometry, since they cover the same pixels.
+   */
+  static ShadowBufferType shadow;
+
+  /**
+   * @brief Rows removed by the last call to clearFullLines.
+   *
+   * Bit y is set when row y, counted before the rows above moved down, was
+   * cleared.
    */
-  uint8_t field[BOARD_HEIGHT][(BOARD_WIDTH * 3 + 7) / 8];
+  uint32_t lastClearedRows;
+
+  uint8_t placedTop;     ///< First row touched by the last placed Tetromino.
+  uint8_t placedBottom;  ///< Last row touched by the last placed Tetromino.
+
+  /**
+   * @brief Height of the stack in every column.
+   *
+   * Counts the rows from the topmost occupied cell of a column down to the
+   * bottom of the board, or 0 for an empty column. Updated when a Tetromino is
+   * placed and recomputed after lines are cleared.
+   */
+  uint8_t columnHeight[Width];
+
+  /**
+   * @brief Recomputes the column heights from the occupancy bitboard.
+   */
+  void updateColumnHeights();
 
  public:
   /**
-   * @brief Constructor of the Board class.
+   * @brief Constructor of the BasicBoard class.
    *
    * Initializes the game board by setting all cells to empty.
    */
-  Board();
+  BasicBoard();
 
   /**
-   * @brief Destructor of the Board class.
+   * @brief Destructor of the BasicBoard class.
    *
    * Cleans up any resources used by the board. No specific actions are
    * performed as no dynamic memory is allocated.
    */
-  ~Board();
+  ~BasicBoard();
 
   /**
    * @brief Retrieves the Tetromino type at a specific position on the board.
    *
-   * Extracts the 3 bits representing the Tetromino type at the given
-   * coordinates and returns the value as a TetrominoType.
+   * Unpacks the cell at the given coordinates and returns the value as a
+   * TetrominoType.
    *
    * @param x The x-coordinate of the cell.
    * @param y The y-coordinate of the cell.
@@ -108,7 +212,9 @@ class Board {
    *
    * Determines if a Tetromino, when moved to the specified position and
    * rotation, would overlap with existing cells or exceed the board's
-   * boundaries.
+   * boundaries. Each shape row is shifted into board position and tested
+   * against the occupancy bitboard. Enable COLLISION_BENCHMARK to time it
+   * against the pixel-by-pixel check it replaced.
    *
    * @param tetromino The Tetromino to check.
    * @param targetX The target x-coordinate.
@@ -123,7 +229,8 @@ class Board {
    * @brief Places a Tetromino on the board.
    *
    * Updates the board state and visually draws the Tetromino on the display
-   * at its current position and rotation.
+   * at its current position and rotation. The rows it touches are recorded
+   * for the next call to clearFullLines.
    *
    * @param tetromino The Tetromino to place on the board.
    */
@@ -132,12 +239,110 @@ class Board {
   /**
    * @brief Clears complete rows on the board.
    *
-   * Checks for fully filled rows, removes them, and shifts the rows above
-   * downward. Updates the display to reflect these changes.
+   * Checks the rows touched by the last placed Tetromino for fully filled
+   * rows, removes them, and compacts the rows above downward in a single
+   * pass. The board state is committed right away, but nothing is redrawn:
+   * the display keeps showing the full rows until the caller redraws the
+   * board, e.g. after a line clear animation.
    *
    * @return The number of rows cleared.
    */
   uint8_t clearFullLines();
+
+  /**
+   * @brief Retrieves the rows removed by the last call to clearFullLines.
+   *
+   * @return A mask with bit y set for every cleared row y, counted before the
+   *         rows above moved down.
+   */
+  uint32_t getClearedRows() const;
+
+  /**
+   * @brief Renders a range of rows into the shadow buffer.
+   *
+   * @param firstRow The first row to draw.
+   * @param lastRow The last row to draw.
+   */
+  void drawRows(uint8_t firstRow, uint8_t lastRow);
+
+  /**
+   * @brief Computes where a Tetromino comes to rest when dropped.
+   *
+   * Compares the bottom profile of the shape with the column heights, so the
+   * result is available without stepping the Tetromino down the board. The
+   * Tetromino is assumed to be dropped from above the stack; cells hidden
+   * under an overhang are not considered.
+   *
+   * @param tetromino The Tetromino to drop.
+   * @param targetX The x-coordinate to drop the Tetromino at.
+   * @param targetRotation The rotation index to drop the Tetromino in.
+   * @return The y-coordinate at which the Tetromino lands.
+   */
+  uint8_t getLandingY(const Tetromino& tetromino, uint8_t targetX,
+                      uint8_t targetRotation) const;
+
+  /**
+   * @brief Renders a single cell into the shadow buffer.
+   *
+   * The cell reaches the display as a block of SCALE x SCALE pixels with the
+   * next flush of the shadow buffer.
+   *
+   * @param x The x-coordinate of the cell.
+   * @param y The y-coordinate of the cell.
+   * @param color The palette color to draw the cell in.
+   */
+  static void drawCell(uint8_t x, uint8_t y, Colors color);
+
+  /**
+   * @brief Provides the shadow buffer of the board region.
+   *
+   * @return The shadow buffer that board rendering goes to.
+   */
+  static ShadowBufferType& getShadow();
+
+  /**
+   * @brief Converts a display x-coordinate into a board column.
+   *
+   * @param x The x-coordinate on the display.
+   * @return The board column, negative left of the board.
+   */
+  static int8_t toColumn(uint8_t x);
+
+  /**
+   * @brief Converts a display y-coordinate into a board row.
+   *
+   * @param y The y-coordinate on the display.
+   * @return The board row, negative above the board.
+   */
+  static int8_t toRow(uint8_t y);
 };
 
+/**
+ * @brief Constants defining the dimensions and offsets of the game board.
+ *
+ * The board is stored in logical cells. Each cell is drawn as a block of
+ * BOARD_SCALE x BOARD_SCALE pixels; the offsets are given in pixels. Adjust
+ * these to fit a different LED panel.
+ */
+#define BOARD_WIDTH 14
+#define BOARD_HEIGHT 20
+#define BOARD_SCALE 2
+#define BOARD_OFFSET_X 3
+#define BOARD_OFFSET_Y 21
+
+/**
+ * @brief Cell packing policy of the game board.
+ *
+ * ThreeBitPacking uses the least RAM, NibblePacking and BytePacking trade RAM
+ * for faster cell access. Enable PACKING_BENCHMARK to compare them.
+ */
+#define BOARD_PACKING ThreeBitPacking
+
+/**
+ * @brief The game board used by the game for the configured panel.
+ */
+typedef BasicBoard<BOARD_WIDTH, BOARD_HEIGHT, BOARD_SCALE, BOARD_OFFSET_X,
+                   BOARD_OFFSET_Y, BOARD_PACKING>
+    Board;
+
 #endif
\ No newline at end of file
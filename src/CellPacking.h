@@ -0,0 +1,132 @@
+#ifndef CELL_PACKING_H
+#define CELL_PACKING_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Cell packing policies for the game board.
+ *
+ * A packing policy decides how many bits a board cell occupies within a row
+ * of the field and how a cell is read and written. Every policy provides:
+ * - BITS: the number of bits per cell,
+ * - get(row, x): the value of cell x in a packed row,
+ * - set(row, x, value): stores the value of cell x in a packed row.
+ *
+ * The board selects its policy at compile time, trading RAM for access speed.
+ */
+
+/**
+ * @brief Packs every cell into 3 bits.
+ *
+ * Uses the least RAM. A cell that crosses a byte boundary is accessed through
+ * a 16-bit window spanning both bytes, which costs a second memory access.
+ */
+struct ThreeBitPacking {
+  static const uint8_t BITS = 3;  ///< Bits per cell.
+
+  /**
+   * @brief Reads a cell from a packed row.
+   *
+   * @param row The packed row.
+   * @param x The x-coordinate of the cell.
+   * @return The value stored in the cell.
+   */
+  static uint8_t get(const uint8_t* row, uint8_t x) {
+    uint8_t bitIndex = x * BITS;
+    uint8_t byteIndex = bitIndex / 8;
+    uint8_t bitOffset = bitIndex % 8;
+
+    uint16_t window = row[byteIndex];
+    if (bitOffset > 8 - BITS) {
+      window |= static_cast<uint16_t>(row[byteIndex + 1]) << 8;
+    }
+
+    return (window >> bitOffset) & 0b111;
+  }
+
+  /**
+   * @brief Writes a cell into a packed row.
+   *
+   * @param row The packed row.
+   * @param x The x-coordinate of the cell.
+   * @param value The value to store in the cell.
+   */
+  static void set(uint8_t* row, uint8_t x, uint8_t value) {
+    uint8_t bitIndex = x * BITS;
+    uint8_t byteIndex = bitIndex / 8;
+    uint8_t bitOffset = bitIndex % 8;
+
+    uint16_t mask = 0b111 << bitOffset;
+    uint16_t bits = (value & 0b111) << bitOffset;
+
+    row[byteIndex] = (row[byteIndex] & ~mask) | bits;
+    if (bitOffset > 8 - BITS) {
+      row[byteIndex + 1] = (row[byteIndex + 1] & ~(mask >> 8)) | (bits >> 8);
+    }
+  }
+};
+
+/**
+ * @brief Packs every cell into a nibble.
+ *
+ * Two cells share a byte and never cross a byte boundary, so every access
+ * touches a single byte.
+ */
+struct NibblePacking {
+  static const uint8_t BITS = 4;  ///< Bits per cell.
+
+  /**
+   * @brief Reads a cell from a packed row.
+   *
+   * @param row The packed row.
+   * @param x The x-coordinate of the cell.
+   * @return The value stored in the cell.
+   */
+  static uint8_t get(const uint8_t* row, uint8_t x) {
+    return (x & 1) ? row[x / 2] >> 4 : row[x / 2] & 0x0F;
+  }
+
+  /**
+   * @brief Writes a cell into a packed row.
+   *
+   * @param row The packed row.
+   * @param x The x-coordinate of the cell.
+   * @param value The value to store in the cell.
+   */
+  static void set(uint8_t* row, uint8_t x, uint8_t value) {
+    if (x & 1) {
+      row[x / 2] = (row[x / 2] & 0x0F) | (value << 4);
+    } else {
+      row[x / 2] = (row[x / 2] & 0xF0) | (value & 0x0F);
+    }
+  }
+};
+
+/**
+ * @brief Stores every cell in its own byte.
+ *
+ * Uses the most RAM but needs no shifting or masking at all.
+ */
+struct BytePacking {
+  static const uint8_t BITS = 8;  ///< Bits per cell.
+
+  /**
+   * @brief Reads a cell from a packed row.
+   *
+   * @param row The packed row.
+   * @param x The x-coordinate of the cell.
+   * @return The value stored in the cell.
+   */
+  static uint8_t get(const uint8_t* row, uint8_t x) { return row[x]; }
+
+  /**
+   * @brief Writes a cell into a packed row.
+   *
+   * @param row The packed row.
+   * @param x The x-coordinate of the cell.
+   * @param value The value to store in the cell.
+   */
+  static void set(uint8_t* row, uint8_t x, uint8_t value) { row[x] = value; }
+};
+
+#endif
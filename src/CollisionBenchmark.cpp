@@ -0,0 +1,206 @@
+#include "CollisionBenchmark.h"
+
+#if COLLISION_BENCHMARK
+
+#include <Arduino.h>
+
+#include "Board.h"
+#include "Tetromino.h"
+
+/**
+ * @brief Keeps the compiler from discarding the benchmarked checks.
+ */
+static volatile uint16_t benchmarkSink;
+
+static_assert(Board::SCALE == 2,
+              "REFERENCE_SHAPES holds shapes of 2 x 2 pixel cells");
+
+/**
+ * @brief Mirrors an 8 x 8 pixel pattern into the bit order of the old check.
+ *
+ * The patterns of TETROMINOES have the top-left pixel in the most significant
+ * bit; the old check expects it in bit 0.
+ */
+constexpr uint64_t referencePattern(uint64_t pattern, uint8_t bit = 0) {
+  return bit == 64 ? 0
+                   : ((pattern >> bit) & 1) << (63 - bit) |
+                         referencePattern(pattern, bit + 1);
+}
+
+/**
+ * @brief Tetromino shapes as 8 x 8 pixel masks, as before the bitboard.
+ *
+ * Bit row * 8 + col covers the pixel at that position relative to the
+ * Tetromino's offset, for every type from I_TETRO on and every rotation. The
+ * patterns are those of TETROMINOES, so both checks test the same shapes.
+ */
+static const uint64_t REFERENCE_SHAPES[7][4] PROGMEM = {
+    {referencePattern(0b0000000000000000000000000000000011111111111111110000000000000000ULL),
+     referencePattern(0b0011000000110000001100000011000000110000001100000011000000110000ULL),
+     referencePattern(0b0000000000000000000000000000000011111111111111110000000000000000ULL),
+     referencePattern(0b0011000000110000001100000011000000110000001100000011000000110000ULL)},  // I-TETRO
+    {referencePattern(0b0000000000000000000000000000000000111100001111000011110000111100ULL),
+     referencePattern(0b0000000000000000000000000000000000111100001111000011110000111100ULL),
+     referencePattern(0b0000000000000000000000000000000000111100001111000011110000111100ULL),
+     referencePattern(0b0000000000000000000000000000000000111100001111000011110000111100ULL)},  // O-TETRO
+    {referencePattern(0b0000000000000000000000000000000011111100111111000011000000110000ULL),
+     referencePattern(0b0000000000000000001100000011000000111100001111000011000000110000ULL),
+     referencePattern(0b0000000000000000001100000011000011111100111111000000000000000000ULL),
+     referencePattern(0b0000000000000000001100000011000011110000111100000011000000110000ULL)},  // T-TETRO
+    {referencePattern(0b0000000000000000000000000000000011000000110000001111110011111100ULL),
+     referencePattern(0b0000000000000000000011000000110000001100000011000011110000111100ULL),
+     referencePattern(0b0000000000000000000000000000000011111100111111000000110000001100ULL),
+     referencePattern(0b0000000000000000001111000011110000110000001100000011000000110000ULL)},  // J-TETRO
+    {referencePattern(0b0000000000000000000000000000000000000011000000110011111100111111ULL),
+     referencePattern(0b0000000000000000001111000011110000001100000011000000110000001100ULL),
+     referencePattern(0b0000000000000000000000000000000000111111001111110011000000110000ULL),
+     referencePattern(0b0000000000000000001100000011000000110000001100000011110000111100ULL)},  // L-TETRO
+    {referencePattern(0b0000000000000000000000000000000000111100001111001111000011110000ULL),
+     referencePattern(0b0000000000000000110000001100000011110000111100000011000000110000ULL),
+     referencePattern(0b0000000000000000000000000000000000111100001111001111000011110000ULL),
+     referencePattern(0b0000000000000000110000001100000011110000111100000011000000110000ULL)},  // S-TETRO
+    {referencePattern(0b0000000000000000000000000000000000111100001111000000111100001111ULL),
+     referencePattern(0b0000000000000000000011000000110000111100001111000011000000110000ULL),
+     referencePattern(0b0000000000000000000000000000000000111100001111000000111100001111ULL),
+     referencePattern(0b0000000000000000000011000000110000111100001111000011000000110000ULL)}  // Z-TETRO
+};
+
+/**
+ * @brief Checks for a collision pixel by pixel, as before the bitboard.
+ *
+ * Walks all 64 bits of the 8 x 8 pixel mask and reads the field once for
+ * every covered pixel, so each cell is read once per pixel it spans. The
+ * coordinates wrap around like those of the old check, which puts positions
+ * left of or above the board out of bounds unless the shape leaves those
+ * pixels empty.
+ *
+ * @param board The board to check against.
+ * @param type The Tetromino type.
+ * @param targetX The target x-coordinate on the display.
+ * @param targetY The target y-coordinate on the display.
+ * @param rotation The target rotation.
+ * @return True if a pixel lies outside the board or on an occupied cell.
+ */
+static bool referenceCollision(const Board& board, TetrominoType type,
+                               uint8_t targetX, uint8_t targetY,
+                               uint8_t rotation) {
+  uint8_t boardX = targetX - Board::OFFSET_X;
+  uint8_t boardY = targetY - Board::OFFSET_Y;
+  uint64_t shape = pgm_read_qword(&REFERENCE_SHAPES[type - 1][rotation]);
+
+  for (uint8_t i = 0; i < 64; i++) {
+    if (shape & (1ULL << i)) {
+      uint8_t fieldX = boardX + i % 8;
+      uint8_t fieldY = boardY + i / 8;
+
+      if (fieldX >= Board::PIXEL_WIDTH || fieldY >= Board::PIXEL_HEIGHT) {
+        return true;
+      }
+      if (board.getFieldType(fieldX / Board::SCALE, fieldY / Board::SCALE) !=
+          NO_TETRO) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Fills the lower half of a board with a fixed pattern with gaps.
+ *
+ * @param board The board to fill.
+ */
+static void fillBoard(Board& board) {
+  board.clear();
+
+  for (uint8_t y = Board::HEIGHT / 2; y < Board::HEIGHT; y++) {
+    for (uint8_t x = 0; x < Board::WIDTH; x++) {
+      if ((x * 7 + y * 13) % 5 < 3) {
+        board.setField(x, y, static_cast<TetrominoType>(1 + (x + y) % 7));
+      }
+    }
+  }
+}
+
+/**
+ * @brief Measures the collision check and reports the results.
+ *
+ * Positions range from one column left of the board to its right edge and
+ * from two rows above the board to its bottom, so the queries include the
+ * out-of-bounds cases the game runs into at the walls and at the spawn.
+ */
+void runCollisionBenchmark() {
+  static Board board;
+  fillBoard(board);
+
+  const uint8_t firstX = Board::OFFSET_X - Board::SCALE;
+  const uint8_t firstY = Board::OFFSET_Y - 2 * Board::SCALE;
+  const uint8_t lastX = Board::OFFSET_X + Board::PIXEL_WIDTH;
+  const uint8_t lastY = Board::OFFSET_Y + Board::PIXEL_HEIGHT;
+
+  uint32_t queries = 0;
+  uint16_t collisions = 0;
+  uint16_t mismatches = 0;
+
+  for (uint8_t type = I_TETRO; type <= Z_TETRO; type++) {
+    Tetromino tetromino(static_cast<TetrominoType>(type));
+    for (uint8_t rotation = 0; rotation < 4; rotation++) {
+      for (uint8_t y = firstY; y < lastY; y += Board::SCALE) {
+        for (uint8_t x = firstX; x < lastX; x += Board::SCALE) {
+          bool bitboard = board.checkCollision(tetromino, x, y, rotation);
+          if (bitboard != referenceCollision(
+                              board, static_cast<TetrominoType>(type), x, y,
+                              rotation)) {
+            mismatches++;
+          }
+          collisions += bitboard;
+          queries++;
+        }
+      }
+    }
+  }
+  benchmarkSink = collisions;
+
+  uint32_t start = micros();
+  for (uint8_t pass = 0; pass < COLLISION_BENCHMARK_PASSES; pass++) {
+    for (uint8_t type = I_TETRO; type <= Z_TETRO; type++) {
+      Tetromino tetromino(static_cast<TetrominoType>(type));
+      for (uint8_t rotation = 0; rotation < 4; rotation++) {
+        for (uint8_t y = firstY; y < lastY; y += Board::SCALE) {
+          for (uint8_t x = firstX; x < lastX; x += Board::SCALE) {
+            benchmarkSink = board.checkCollision(tetromino, x, y, rotation);
+          }
+        }
+      }
+    }
+  }
+  uint32_t bitboardTime = micros() - start;
+
+  start = micros();
+  for (uint8_t pass = 0; pass < COLLISION_BENCHMARK_PASSES; pass++) {
+    for (uint8_t type = I_TETRO; type <= Z_TETRO; type++) {
+      for (uint8_t rotation = 0; rotation < 4; rotation++) {
+        for (uint8_t y = firstY; y < lastY; y += Board::SCALE) {
+          for (uint8_t x = firstX; x < lastX; x += Board::SCALE) {
+            benchmarkSink = referenceCollision(
+                board, static_cast<TetrominoType>(type), x, y, rotation);
+          }
+        }
+      }
+    }
+  }
+  uint32_t referenceTime = micros() - start;
+
+  board.clear();
+
+  Serial.print(F("Collision benchmark: "));
+  Serial.print(queries * COLLISION_BENCHMARK_PASSES);
+  Serial.print(F(" queries, bitboard "));
+  Serial.print(bitboardTime);
+  Serial.print(F(" us, pixel by pixel "));
+  Serial.print(referenceTime);
+  Serial.print(F(" us, mismatches "));
+  Serial.println(mismatches);
+}
+
+#endif
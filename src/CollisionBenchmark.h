@@ -0,0 +1,32 @@
+#ifndef COLLISION_BENCHMARK_H
+#define COLLISION_BENCHMARK_H
+
+/**
+ * @brief Enables the collision check benchmark at startup.
+ *
+ * Set to 1 to time Board::checkCollision against the pixel-by-pixel check it
+ * replaced over Serial before the game starts. Left at 0, the benchmark is
+ * not compiled into the sketch.
+ */
+#ifndef COLLISION_BENCHMARK
+#define COLLISION_BENCHMARK 0
+#endif
+
+/**
+ * @brief Number of times the benchmark repeats every query.
+ */
+#define COLLISION_BENCHMARK_PASSES 10
+
+/**
+ * @brief Measures the collision check and reports the results.
+ *
+ * Queries every Tetromino type and rotation at every position on a partly
+ * filled board, first with the occupancy bitboard of Board::checkCollision,
+ * then like before the bitboard: walking an 8 x 8 pixel mask and calling
+ * getFieldType for every covered pixel. Prints the number of queries, both
+ * times in microseconds and the number of queries whose results differ,
+ * which must be 0.
+ */
+void runCollisionBenchmark();
+
+#endif
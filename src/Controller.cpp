@@ -1,29 +1,123 @@
 #include "Controller.h"
 
+#include "LatencyProbe.h"
+
+/**
+ * @brief Determines how often a held key repeats.
+ *
+ * @param key The character of the key.
+ * @return The repeat interval in microseconds, or 0 if the key does not
+ * repeat.
+ */
+static uint32_t repeatInterval(char key) {
+  switch (key) {
+    case '6':
+    case '4':
+      return KEY_REPEAT_INTERVAL * 1000UL;
+    case '2':
+      return SOFT_DROP_REPEAT_INTERVAL * 1000UL;
+    default:
+      return 0;
+  }
+}
+
 /**
  * @brief Constructor for the Controller class.
  *
  * Initializes the keypad object with the keymap, row pins, and column pins.
  * Sets the initial press start time to zero.
  */
+#if KEYPAD_SCAN_ISR
+Controller::Controller()
+    : pressStartTime(0),
+      repeatKey(NO_KEY),
+      nextRepeatTime(0),
+      hasPendingEvent(false) {}
+#else
 Controller::Controller()
     : keypad(makeKeymap(keymap), (byte*)rowPins, (byte*)colPins, KEYPAD_ROWS,
              KEYPAD_COLS),
-      pressStartTime(0) {}
+      polledKey(NO_KEY),
+      pressStartTime(0),
+      repeatKey(NO_KEY),
+      nextRepeatTime(0),
+      hasPendingEvent(false) {}
+#endif
 
 /**
  * @brief Initializes the keypad and resets the press state.
  *
- * Configures the debounce time for the keypad to 10 milliseconds and waits
- * until no key is pressed before proceeding.
+ * Starts the scan interrupt, or configures the debounce time for the keypad
+ * to 10 milliseconds. Keys held down at this point are not reported as
+ * presses.
  */
 void Controller::init() {
-  keypad.setDebounceTime(10);  // Set debounce time for stable key detection
   pressStartTime = 0;
+  repeatKey = NO_KEY;
+  hasPendingEvent = false;
+
+#if KEYPAD_SCAN_ISR
+  scanner.begin();
+#else
+  keypad.setDebounceTime(10);  // Set debounce time for stable key detection
 
   // Wait until no key is pressed to ensure a clean initialization state
   while (keypad.getKey() != NO_KEY) {
   }
+  polledKey = NO_KEY;
+#endif
+}
+
+/**
+ * @brief Reads the next press or release from the keypad.
+ *
+ * Pops the queue of the scan interrupt, or polls the keypad and times the
+ * change now. The Keypad library reports only the first key down, so when
+ * polled, a key pressed while another is held is missed.
+ *
+ * @param event Receives the event.
+ * @return True if there was an event, otherwise false.
+ */
+bool Controller::readEvent(KeyEvent& event) {
+#if KEYPAD_SCAN_ISR
+  return scanner.pop(event);
+#else
+  char key = keypad.getKey();
+  KeyState keyState = keypad.getState();
+
+  if (key != NO_KEY && keyState == PRESSED) {
+    polledKey = key;
+    event.key = key;
+    event.pressed = true;
+    event.time = micros();
+    return true;
+  }
+
+  if (polledKey != NO_KEY && (keyState == RELEASED || keyState == IDLE)) {
+    event.key = polledKey;
+    event.pressed = false;
+    event.time = micros();
+    polledKey = NO_KEY;
+    return true;
+  }
+  return false;
+#endif
+}
+
+/**
+ * @brief Looks at the next press or release without handling it.
+ *
+ * The event is kept until hasPendingEvent is cleared.
+ *
+ * @param event Receives the event.
+ * @return True if there is an event, otherwise false.
+ */
+bool Controller::peekEvent(KeyEvent& event) {
+  if (!hasPendingEvent) {
+    hasPendingEvent = readEvent(pendingEvent);
+  }
+  event = pendingEvent;
+  return hasPendingEvent;
 }
 
 /**
@@ -36,30 +130,61 @@ void Controller::init() {
  * @return True if the specified key is currently pressed, otherwise false.
  */
 bool Controller::isKeyPressed(char key) {
+#if KEYPAD_SCAN_ISR
+  return scanner.isPressed(key);
+#else
   char keyPressed = keypad.getKey();  // Get the currently pressed key
   return keyPressed == key;  // Return true if it matches the specified key
+#endif
 }
 
 /**
- * @brief Handles key presses and distinguishes between short and long presses.
+ * @brief Handles key presses and repeats held move keys.
  *
- * Detects the state of the currently pressed key and differentiates between
- * short presses (PRESSED state) and long presses (HOLD state). Long presses
- * are detected when the key is held down for at least 100 milliseconds.
+ * A press of left, right or down makes that key the held one, replacing any
+ * other; its release ends the repeats. The held key repeats KEY_REPEAT_DELAY
+ * after its press and then at its repeat interval. The repeat times follow
+ * from the press time alone, so a late call returns every repeat that fell
+ * due since the last one, and a release that happened before a repeat
+ * was due cancels it. Presses are timed when they were detected rather than
+ * when they are handled, so the latency probe also covers the time they
+ * waited in the queue.
  *
- * @return The character of the pressed key, or NO_KEY if no key is pressed.
+ * @return The character of the pressed or repeated key, or NO_KEY if there
+ * is none.
  */
 char Controller::handleKeyPress() {
-  char key = keypad.getKey(); // Get the current key being pressed
-  KeyState keyState = keypad.getState(); // Get the state of the key
+  uint32_t currentTime = micros();
+  KeyEvent event;
+
+  while (true) {
+    bool hasEvent = peekEvent(event);
+
+    if (repeatKey != NO_KEY &&
+        static_cast<int32_t>(currentTime - nextRepeatTime) >= 0 &&
+        (!hasEvent || static_cast<int32_t>(event.time - nextRepeatTime) > 0)) {
+      nextRepeatTime += repeatInterval(repeatKey);
+      return repeatKey;
+    }
+
+    if (!hasEvent) {
+      return NO_KEY;
+    }
+    hasPendingEvent = false;
 
-  if (key != NO_KEY) { // If a key is pressed
-    uint32_t currentTime = millis(); // Get the current time in milliseconds
+    if (!event.pressed) {
+      if (event.key == repeatKey) {
+        repeatKey = NO_KEY;
+      }
+      continue;
+    }
 
-    if (keyState == PRESSED) { // Handle a short press
-      pressStartTime = currentTime; // Record the press start time
-      return key; // Return the pressed key
+    pressStartTime = event.time;  // Record the press start time
+    if (repeatInterval(event.key) > 0) {
+      repeatKey = event.key;
+      nextRepeatTime = pressStartTime + KEY_REPEAT_DELAY * 1000UL;
     }
+    LATENCY_PROBE_KEY(event.key, event.time);
+    return event.key;
   }
-  return NO_KEY; // Return NO_KEY if no valid key press is detected
 }
@@ -1,44 +1,102 @@
 #ifndef CONTROLLER_H
 #define CONTROLLER_H
 
-#include <Keypad.h>
+#include <Arduino.h>
+
+#include "KeypadLayout.h"
+
+/**
+ * @brief Time between two polls of the keypad in milliseconds.
+ */
+#define INPUT_PERIOD 10
+
+/**
+ * @brief Time a move key must be held before it starts repeating, in
+ * milliseconds.
+ *
+ * Applies to left, right and down, timed from the press.
+ */
+#define KEY_REPEAT_DELAY 170
 
 /**
- * @brief Defines the number of rows and columns for the keypad.
+ * @brief Time between two repeats of a held left or right key in
+ * milliseconds.
  */
-#define KEYPAD_ROWS 4
-#define KEYPAD_COLS 4
+#define KEY_REPEAT_INTERVAL 50
 
 /**
- * @brief Key mapping for the keypad.
+ * @brief Time between two repeats of a held down key in milliseconds.
  *
- * Maps each button on the 4x4 keypad to a character. These characters represent
- * the keys available to the player.
+ * Shorter than KEY_REPEAT_INTERVAL, so a held down key drops the Tetromino
+ * faster than gravity does at any level.
  */
-const char keymap[KEYPAD_ROWS][KEYPAD_COLS] = {{'1', '2', '3', 'A'},
-                                               {'7', '8', '9', 'C'},
-                                               {'4', '5', '6', 'B'},
-                                               {'*', '0', '#', 'D'}};
+#define SOFT_DROP_REPEAT_INTERVAL 30
 
 /**
- * @brief Pin configuration for the keypad rows and columns.
+ * @brief Scans the keypad from a timer interrupt.
  *
- * Defines which microcontroller pins are connected to the rows and columns
- * of the keypad.
+ * When 1, KeypadScanner scans and debounces the keypad in the background and
+ * queues every press and release with its time. When 0, the Keypad library
+ * is polled by the input task and its changes are timed when they are
+ * polled, for the first key down only. Defaults to 1 on AVR; the host build
+ * polls the Keypad stub.
+ */
+#ifndef KEYPAD_SCAN_ISR
+#ifdef __AVR__
+#define KEYPAD_SCAN_ISR 1
+#else
+#define KEYPAD_SCAN_ISR 0
+#endif
+#endif
+
+#if KEYPAD_SCAN_ISR
+#include "KeypadScanner.h"
+
+/**
+ * @brief Value returned when no key was pressed, as with the Keypad library.
  */
-const byte rowPins[KEYPAD_ROWS] = {37, 39, 41, 43};
-const byte colPins[KEYPAD_COLS] = {45, 47, 49, 51};
+#define NO_KEY '\0'
+#else
+#include <Keypad.h>
+#endif
 
 /**
  * @brief The Controller class manages input handling through the keypad.
  *
  * This class initializes the keypad, processes key presses, and handles
- * debouncing and long-press detection.
+ * debouncing and auto-repeat of held move keys.
  */
 class Controller {
  private:
-  Keypad keypad;            ///< Keypad object to manage input detection.
-  uint32_t pressStartTime;  ///< Tracks the time when a key press starts.
+#if KEYPAD_SCAN_ISR
+  KeypadScanner scanner;  ///< Scans the keypad from a timer interrupt.
+#else
+  Keypad keypad;  ///< Keypad object to manage input detection.
+  char polledKey;  ///< Key reported pressed and not yet released.
+#endif
+  uint32_t pressStartTime;  ///< Time the last key press started in us.
+
+  char repeatKey;           ///< Held move key, or NO_KEY.
+  uint32_t nextRepeatTime;  ///< Time the held key repeats next in us.
+
+  KeyEvent pendingEvent;  ///< Event read from the keypad but not handled.
+  bool hasPendingEvent;   ///< Whether pendingEvent holds an event.
+
+  /**
+   * @brief Reads the next press or release from the keypad.
+   *
+   * @param event Receives the event.
+   * @return True if there was an event, otherwise false.
+   */
+  bool readEvent(KeyEvent& event);
+
+  /**
+   * @brief Looks at the next press or release without handling it.
+   *
+   * @param event Receives the event.
+   * @return True if there is an event, otherwise false.
+   */
+  bool peekEvent(KeyEvent& event);
 
  public:
   /**
@@ -58,10 +116,10 @@ class Controller {
   void init();
 
   /**
-   * @brief Handles key presses and detects short or long presses.
+   * @brief Handles key presses and repeats held move keys.
    *
-   * Checks the state of the keypad and determines if a key is being pressed
-   * or held down for a long duration.
+   * Returns the pressed and repeated keys one per call in the order they
+   * happened, so calling it until it returns NO_KEY handles all of them.
    *
    * @return The character of the pressed key, or NO_KEY if no key is pressed.
    */
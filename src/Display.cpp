@@ -1,17 +1,35 @@
 #include "Display.h"
 
-#include <RGBmatrixPanel.h>
 #include <avr/pgmspace.h>
 
 #include "Fonts/FreeMonoBold9pt7b.h"
+#include "Board.h"
 #include "Fonts/Picopixel.h"
+#include "HudNumber.h"
+#include "LatencyProbe.h"
 #include "Tetromino.h"
 
+#if DISPLAY_BAKED_SCREENS
+#ifdef __has_include
+#if !__has_include("BakedScreens.h")
+#error "DISPLAY_BAKED_SCREENS needs src/BakedScreens.h, see extras/host"
+#endif
+#endif
+#include "BakedScreens.h"
+#endif
+
 /**
  * @brief Global instance of the RGB matrix panel for controlling the LED
  * display.
  */
-RGBmatrixPanel matrix(A, B, C, D, E, CLK, LAT, OE, false, 64);
+DisplayMatrix matrix(A, B, C, D, E, CLK, LAT, OE, DISPLAY_DOUBLE_BUFFER, 64);
+
+uint32_t Display::frameStartMicros = 0;
+uint32_t Display::frameTime = 0;
+uint32_t Display::maxFrameTime = 0;
+uint32_t Display::totalFrameTime = 0;
+uint16_t Display::frameCount = 0;
+uint16_t Display::lateFrames = 0;
 
 /**
  * @brief Color values for the display, stored in program memory.
@@ -44,45 +62,89 @@ uint16_t Display::getColor(Colors color) {
   return pgm_read_word(&(displayColors[color]));
 }
 
-const uint8_t COFFEE_CUP[26][22] PROGMEM = {
-    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    {0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0},
-    {0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0},
-    {0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
-    {0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1},
-    {0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1},
-    {0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1},
-    {0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1},
-    {0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
-    {0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0},
-    {0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0},
-    {0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0},
-    {0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0},
-    {0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0},
-    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0},
-    {0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0}};
-
-const uint8_t MUSIC[20][9] PROGMEM = {
-    {0, 0, 0, 0, 0, 0, 1, 1, 1}, {0, 0, 0, 1, 1, 1, 1, 1, 1},
-    {0, 0, 0, 1, 1, 1, 1, 1, 1}, {0, 0, 0, 1, 1, 1, 0, 0, 1},
-    {0, 0, 0, 1, 0, 0, 0, 0, 1}, {0, 0, 0, 1, 0, 0, 0, 0, 1},
-    {0, 0, 0, 1, 0, 0, 1, 1, 1}, {0, 1, 1, 1, 0, 1, 1, 1, 1},
-    {1, 1, 1, 1, 0, 0, 1, 1, 0}, {0, 1, 1, 0, 0, 0, 0, 0, 0},
-    {0, 0, 0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 1, 1, 1, 0},
-    {0, 0, 0, 1, 1, 1, 1, 1, 0}, {0, 0, 0, 1, 1, 0, 0, 1, 0},
-    {0, 0, 0, 1, 0, 0, 0, 1, 0}, {0, 0, 0, 1, 0, 0, 1, 1, 0},
-    {0, 0, 1, 1, 0, 1, 1, 1, 0}, {0, 1, 1, 1, 0, 0, 1, 0, 0},
-    {0, 0, 1, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0, 0, 0}};
+/**
+ * @brief Packs up to eight sprite pixels into a byte at compile time.
+ *
+ * Pixels are written as '#' (set) and '.' (clear), so the sprite sources read
+ * like the picture they describe. The leftmost pixel ends up in the most
+ * significant bit; a row may end before the byte is full.
+ */
+constexpr uint8_t spriteByte(const char* pixels, uint8_t bit = 0) {
+  return bit == 8 || pixels[bit] == '\0'
+             ? 0
+             : (pixels[bit] == '#' ? 0x80 >> bit : 0) |
+                   spriteByte(pixels, bit + 1);
+}
+
+/**
+ * @brief Packs a sprite row of up to 16 or 24 pixels into 1bpp bytes.
+ */
+#define SPRITE_ROW_2(pixels) spriteByte(pixels), spriteByte(pixels + 8)
+#define SPRITE_ROW_3(pixels) SPRITE_ROW_2(pixels), spriteByte(pixels + 16)
+
+/**
+ * @brief Coffee cup icon of the pause screen, 22x26 pixels at 1bpp.
+ */
+#define COFFEE_CUP_WIDTH 22
+#define COFFEE_CUP_HEIGHT 26
+const uint8_t COFFEE_CUP[] PROGMEM = {
+    SPRITE_ROW_3(".............#........"),
+    SPRITE_ROW_3("...........##........."),
+    SPRITE_ROW_3("........#.##.........."),
+    SPRITE_ROW_3(".......#..##.........."),
+    SPRITE_ROW_3(".......#..##.........."),
+    SPRITE_ROW_3("........#.##.........."),
+    SPRITE_ROW_3(".........#..##........"),
+    SPRITE_ROW_3(".........#..##........"),
+    SPRITE_ROW_3("........#..##........."),
+    SPRITE_ROW_3("..........#..........."),
+    SPRITE_ROW_3("......................"),
+    SPRITE_ROW_3("..################...."),
+    SPRITE_ROW_3("..##################.."),
+    SPRITE_ROW_3("..####################"),
+    SPRITE_ROW_3("..################..##"),
+    SPRITE_ROW_3("..################..##"),
+    SPRITE_ROW_3("..################..##"),
+    SPRITE_ROW_3("..################..##"),
+    SPRITE_ROW_3("..####################"),
+    SPRITE_ROW_3("..##################.."),
+    SPRITE_ROW_3("..################...."),
+    SPRITE_ROW_3("...##############....."),
+    SPRITE_ROW_3("....############......"),
+    SPRITE_ROW_3(".....##########......."),
+    SPRITE_ROW_3("#####################."),
+    SPRITE_ROW_3(".###################.."),
+};
+
+/**
+ * @brief Volume note icons of the start screen, 9x10 pixels each at 1bpp.
+ */
+#define VOLUME_ICON_WIDTH 9
+#define VOLUME_ICON_HEIGHT 10
+const uint8_t VOLUME_UP_ICON[] PROGMEM = {
+    SPRITE_ROW_2("......###"),
+    SPRITE_ROW_2("...######"),
+    SPRITE_ROW_2("...######"),
+    SPRITE_ROW_2("...###..#"),
+    SPRITE_ROW_2("...#....#"),
+    SPRITE_ROW_2("...#....#"),
+    SPRITE_ROW_2("...#..###"),
+    SPRITE_ROW_2(".###.####"),
+    SPRITE_ROW_2("####..##."),
+    SPRITE_ROW_2(".##......"),
+};
+const uint8_t VOLUME_DOWN_ICON[] PROGMEM = {
+    SPRITE_ROW_2("........."),
+    SPRITE_ROW_2(".....###."),
+    SPRITE_ROW_2("...#####."),
+    SPRITE_ROW_2("...##..#."),
+    SPRITE_ROW_2("...#...#."),
+    SPRITE_ROW_2("...#..##."),
+    SPRITE_ROW_2("..##.###."),
+    SPRITE_ROW_2(".###..#.."),
+    SPRITE_ROW_2("..#......"),
+    SPRITE_ROW_2("........."),
+};
 
 const char TITLE_LABEL[] PROGMEM = "TETRIS";
 const char KEY_LABELS[][1] PROGMEM = {'A', 'B', '6', '4', '5', '2', '#', '*'};
@@ -130,6 +192,13 @@ const uint8_t POSITIONS[][2] PROGMEM = {
     {43, 36}   // VolDown
 };
 
+/**
+ * @brief Numbers shown on the HUD: the level and the score and lines count.
+ */
+HudNumber levelNumber(2);
+HudNumber scoreNumber(5);
+HudNumber linesNumber(5);
+
 /**
  * @brief Initializes the RGB matrix display and renders the startup screen.
  *
@@ -151,7 +220,14 @@ const uint8_t POSITIONS[][2] PROGMEM = {
  * clear differentiation.
  */
 void Display::initDisplay() {
+#if DISPLAY_PALETTE_DRIVER
+  matrix.setPalette(displayColors, NUM_COLORS);
+#endif
   matrix.begin();
+
+#if DISPLAY_BAKED_SCREENS
+  drawScreen(TITLE_SCREEN);
+#else
   matrix.fillScreen(Display::getColor(BLACK));
 
   matrix.setFont(&FreeMonoBold9pt7b);
@@ -212,33 +288,182 @@ void Display::initDisplay() {
     matrix.print(keyChar);
   }
 
-  uint8_t xUp = pgm_read_byte(&POSITIONS[26][0]);
-  uint8_t yUp = pgm_read_byte(&POSITIONS[26][1]);
+  // Render the volume icons as a blue and a cyan note
+  drawSprite(VOLUME_UP_ICON, VOLUME_ICON_WIDTH, VOLUME_ICON_HEIGHT,
+             pgm_read_byte(&POSITIONS[26][0]), pgm_read_byte(&POSITIONS[26][1]),
+             BLUE);
+  drawSprite(VOLUME_DOWN_ICON, VOLUME_ICON_WIDTH, VOLUME_ICON_HEIGHT,
+             pgm_read_byte(&POSITIONS[27][0]),
+             pgm_read_byte(&POSITIONS[27][1]) + VOLUME_ICON_HEIGHT, CYAN);
+#endif
+
+  present();
+}
+
+/**
+ * @brief Starts a new frame.
+ *
+ * The scheduler keeps frames on a fixed grid of FRAME_INTERVAL milliseconds.
+ * A frame that overran its slot starts the next one right away instead of
+ * trying to catch up with several short frames.
+ */
+void Display::beginFrame() { frameStartMicros = micros(); }
+
+/**
+ * @brief Finishes the current frame.
+ *
+ * Presents the frame, which ends the latency measurement of the key presses
+ * it responds to, and records its duration. With FRAME_REPORT enabled,
+ * prints the last, average and longest frame time and the number of frames
+ * over budget every FRAME_REPORT_FRAMES frames, plus the CPU share of the
+ * refresh interrupt with DISPLAY_PALETTE_DRIVER.
+ */
+void Display::endFrame() {
+  present();
+  LATENCY_PROBE_FRAME();
+
+  frameTime = micros() - frameStartMicros;
+
+  if (frameTime > FRAME_INTERVAL * 1000UL) {
+    lateFrames++;
+  }
+  if (frameTime > maxFrameTime) {
+    maxFrameTime = frameTime;
+  }
+  totalFrameTime += frameTime;
+  frameCount++;
+
+  if (frameCount < FRAME_REPORT_FRAMES) {
+    return;
+  }
+
+#if FRAME_REPORT
+  Serial.print(F("frame us: last "));
+  Serial.print(frameTime);
+  Serial.print(F(" avg "));
+  Serial.print(totalFrameTime / frameCount);
+  Serial.print(F(" max "));
+  Serial.print(maxFrameTime);
+  Serial.print(F(" late "));
+  Serial.print(lateFrames);
+#if DISPLAY_PALETTE_DRIVER
+  Serial.print(F(" isr permille "));
+  Serial.print(matrix.getIsrDuty());
+#endif
+  Serial.println();
+#endif
+
+  maxFrameTime = 0;
+  totalFrameTime = 0;
+  frameCount = 0;
+  lateFrames = 0;
+}
+
+/**
+ * @brief Shows everything drawn so far.
+ *
+ * In double-buffered mode, the swap takes effect at the end of the current
+ * panel refresh, so a frame never appears half drawn. The new back buffer is
+ * filled with a copy of the visible one, because rendering only draws what
+ * changed since the last frame.
+ */
+void Display::present() {
+#if DISPLAY_DOUBLE_BUFFER
+  matrix.swapBuffers(true);
+#endif
+}
+
+/**
+ * @brief Retrieves the duration of the last frame.
+ *
+ * @return The time from beginFrame to the end of endFrame in microseconds.
+ */
+uint32_t Display::getFrameTime() { return frameTime; }
+
+/**
+ * @brief Draws a 1bpp sprite stored in program memory.
+ *
+ * Reads every sprite byte once and draws each horizontal run of set pixels
+ * with a single drawFastHLine call. With a gradient, the row color steps
+ * through the rainbow colors MAGENTA to RED, advancing every gradientRows
+ * rows, starting at the given color.
+ *
+ * @param sprite The packed rows of the sprite, (width + 7) / 8 bytes each.
+ * @param width The width of the sprite in pixels.
+ * @param height The height of the sprite in pixels.
+ * @param x The x-coordinate of the sprite's top left corner.
+ * @param y The y-coordinate of the sprite's top left corner.
+ * @param color The color of the sprite or the first gradient color.
+ * @param gradientRows Rows per gradient color, 0 for a single color.
+ */
+void drawSprite(const uint8_t* sprite, uint8_t width, uint8_t height,
+                uint8_t x, uint8_t y, Colors color, uint8_t gradientRows) {
+  for (uint8_t row = 0; row < height; row++) {
+    Colors rowColor = color;
+    if (gradientRows > 0) {
+      rowColor = static_cast<Colors>((color + row / gradientRows) % (RED + 1));
+    }
+    uint16_t rgb = Display::getColor(rowColor);
+
+    uint8_t bits = 0;
+    uint8_t runStart = 0;
+    uint8_t runLength = 0;
 
-  matrix.setCursor(xUp, yUp);
+    for (uint8_t col = 0; col < width; col++, bits <<= 1) {
+      if (col % 8 == 0) {
+        bits = pgm_read_byte(sprite++);
+      }
 
-  // Render the volume up icon as a blue note
-  for (uint8_t row = 0; row < 10; row++) {
-    for (uint8_t col = 0; col < 9; col++) {
-      uint8_t pixel = pgm_read_byte(&(MUSIC[row][col]));
-      if (pixel == 1) {
-        matrix.drawPixel(xUp + col, yUp + row, Display::getColor(BLUE));
+      if (bits & 0x80) {
+        if (runLength == 0) {
+          runStart = col;
+        }
+        runLength++;
+      } else if (runLength > 0) {
+        matrix.drawFastHLine(x + runStart, y + row, runLength, rgb);
+        runLength = 0;
       }
     }
+
+    if (runLength > 0) {
+      matrix.drawFastHLine(x + runStart, y + row, runLength, rgb);
+    }
   }
+}
 
-  uint8_t xDown = pgm_read_byte(&POSITIONS[27][0]);
-  uint8_t yDown = pgm_read_byte(&POSITIONS[27][1]);
+/**
+ * @brief Draws a pre-rendered screen stored in program memory.
+ *
+ * Clears the panel once and decodes the runs in a single pass. Black runs
+ * are skipped, all others are drawn as horizontal lines, split where a run
+ * wraps to the next row.
+ *
+ * @param screen The encoded runs of the screen.
+ */
+void drawScreen(const uint8_t* screen) {
+  matrix.fillScreen(Display::getColor(BLACK));
+
+  uint16_t pixel = 0;
+  while (pixel < SCREEN_WIDTH * SCREEN_HEIGHT) {
+    uint8_t run = pgm_read_byte(screen++);
+    Colors color = static_cast<Colors>(run >> 4);
+    uint16_t length = (run & 0x0F) + 1;
+    if (length == 16) {
+      length += pgm_read_byte(screen++);
+    }
 
-  matrix.setCursor(xDown, yDown);
+    if (color == BLACK) {
+      pixel += length;
+      continue;
+    }
 
-  // Render the volume down icon as a cyan note
-  for (uint8_t row = 10; row < 20; row++) {
-    for (uint8_t col = 0; col < 9; col++) {
-      uint8_t pixel = pgm_read_byte(&(MUSIC[row][col]));
-      if (pixel == 1) {
-        matrix.drawPixel(xDown + col, yDown + row, Display::getColor(CYAN));
-      }
+    uint16_t rgb = Display::getColor(color);
+    for (uint16_t end = pixel + length; pixel < end;) {
+      uint8_t x = pixel % SCREEN_WIDTH;
+      uint8_t width = min(SCREEN_WIDTH - x, end - pixel);
+
+      matrix.drawFastHLine(x, pixel / SCREEN_WIDTH, width, rgb);
+      pixel += width;
     }
   }
 }
@@ -250,16 +475,23 @@ void Display::initDisplay() {
  * and cleared lines.
  */
 void drawStaticElements() {
+  Board::getShadow().invalidate(BLACK);
+  levelNumber.reset();
+  scoreNumber.reset();
+  linesNumber.reset();
+
+#if DISPLAY_BAKED_SCREENS
+  drawScreen(HUD_SCREEN);
+#else
   matrix.fillScreen(Display::getColor(BLACK));
 
-  matrix.drawFastVLine(1, 19, 44, Display::getColor(GRAY));
-  matrix.drawFastVLine(2, 19, 44, Display::getColor(GRAY));
-  matrix.drawFastVLine(31, 19, 44, Display::getColor(GRAY));
-  matrix.drawFastVLine(32, 19, 44, Display::getColor(GRAY));
-  matrix.drawFastHLine(3, 19, 28, Display::getColor(GRAY));
-  matrix.drawFastHLine(3, 20, 28, Display::getColor(GRAY));
-  matrix.drawFastHLine(3, 61, 28, Display::getColor(GRAY));
-  matrix.drawFastHLine(3, 62, 28, Display::getColor(GRAY));
+  // Draw a two pixel wide container frame around the board
+  matrix.drawRect(Board::OFFSET_X - 2, Board::OFFSET_Y - 2,
+                  Board::PIXEL_WIDTH + 4, Board::PIXEL_HEIGHT + 4,
+                  Display::getColor(GRAY));
+  matrix.drawRect(Board::OFFSET_X - 1, Board::OFFSET_Y - 1,
+                  Board::PIXEL_WIDTH + 2, Board::PIXEL_HEIGHT + 2,
+                  Display::getColor(GRAY));
 
   matrix.setFont(NULL);
 
@@ -273,78 +505,46 @@ void drawStaticElements() {
     matrix.setTextColor(Display::getColor(GRAY));
     matrix.print(reinterpret_cast<const __FlashStringHelper*>(label));
   }
+#endif
 }
 
 /**
  * @brief Updates the displayed game level.
  *
- * Clears the previous level value and displays the new one.
+ * Redraws only the digits that differ from the displayed level.
  *
  * @param level The current game level.
  */
 void updateLevelDisplay(uint8_t level) {
-  uint8_t x = pgm_read_byte(&POSITIONS[17][0]);
-  uint8_t y = pgm_read_byte(&POSITIONS[17][1]);
-
-  matrix.fillRect(x, y, 11, 7, Display::getColor(BLACK));
-
-  matrix.setFont(NULL);
-  matrix.setCursor(x, y);
-  matrix.setTextColor(Display::getColor(WHITE));
-  if (level < 10) {
-    matrix.print("0");
-  }
-  matrix.print(level);
+  levelNumber.draw(pgm_read_byte(&POSITIONS[17][0]),
+                   pgm_read_byte(&POSITIONS[17][1]), level,
+                   Display::getColor(WHITE));
 }
 
 /**
  * @brief Updates the displayed game score.
  *
- * Clears the previous score value and displays the new one.
+ * Redraws only the digits that differ from the displayed score.
  *
  * @param score The current game score.
  */
 void updateScoreDisplay(uint16_t score) {
-  uint8_t x = pgm_read_byte(&POSITIONS[18][0]);
-  uint8_t y = pgm_read_byte(&POSITIONS[18][1]);
-
-  matrix.fillRect(x, y, 30, 7, Display::getColor(BLACK));
-
-  matrix.setFont(NULL);
-  matrix.setCursor(x, y);
-  matrix.setTextColor(Display::getColor(WHITE));
-
-  if (score < 10000) matrix.print("0");
-  if (score < 1000) matrix.print("0");
-  if (score < 100) matrix.print("0");
-  if (score < 10) matrix.print("0");
-
-  matrix.print(score);
+  scoreNumber.draw(pgm_read_byte(&POSITIONS[18][0]),
+                   pgm_read_byte(&POSITIONS[18][1]), score,
+                   Display::getColor(WHITE));
 }
 
 /**
  * @brief Updates the displayed number of lines cleared.
  *
- * Clears the previous value and displays the new one.
+ * Redraws only the digits that differ from the displayed count.
  *
  * @param lines The number of cleared lines.
  */
 void updateLinesDisplay(uint16_t lines) {
-  uint8_t x = pgm_read_byte(&POSITIONS[20][0]);
-  uint8_t y = pgm_read_byte(&POSITIONS[20][1]);
-
-  matrix.fillRect(x, y, 30, 7, Display::getColor(BLACK));
-
-  matrix.setFont(NULL);
-  matrix.setCursor(x, y);
-  matrix.setTextColor(Display::getColor(WHITE));
-
-  if (lines < 10000) matrix.print("0");
-  if (lines < 1000) matrix.print("0");
-  if (lines < 100) matrix.print("0");
-  if (lines < 10) matrix.print("0");
-
-  matrix.print(lines);
+  linesNumber.draw(pgm_read_byte(&POSITIONS[20][0]),
+                   pgm_read_byte(&POSITIONS[20][1]), lines,
+                   Display::getColor(WHITE));
 }
 
 /**
@@ -372,32 +572,17 @@ void pauseDisplay() {
 
   matrix.fillScreen(Display::getColor(BLACK));
 
-  matrix.setCursor(x, y);
-
-  uint8_t colorIndex = 0;
-
   // Draw the coffee cup icon with a color gradient
-  for (uint8_t row = 0; row < 26; row++) {
-    if (row % 2 == 0 && row > 0) {
-      colorIndex = (colorIndex + 1) % 7;
-    }
-
-    uint16_t color = Display::getColor(static_cast<Colors>(colorIndex));
-
-    for (uint8_t col = 0; col < 22; col++) {
-      uint8_t pixel = pgm_read_byte(&(COFFEE_CUP[row][col]));
-
-      if (pixel == 1) {
-        matrix.drawPixel(x + col, y + row, color);
-      }
-    }
-  }
+  drawSprite(COFFEE_CUP, COFFEE_CUP_WIDTH, COFFEE_CUP_HEIGHT, x, y, MAGENTA, 2);
 }
 
 /**
  * @brief Displays the "Game Over" screen and waits for a restart input.
  */
 void gameOverDisplay() {
+#if DISPLAY_BAKED_SCREENS
+  drawScreen(GAME_OVER_SCREEN);
+#else
   uint8_t x1 = pgm_read_byte(&POSITIONS[21][0]);
   uint8_t y1 = pgm_read_byte(&POSITIONS[21][1]);
   uint8_t x2 = pgm_read_byte(&POSITIONS[22][0]);
@@ -427,4 +612,5 @@ void gameOverDisplay() {
   matrix.setCursor(x2, y2);
   matrix.setTextColor(Display::getColor(WHITE));
   matrix.print(reinterpret_cast<const __FlashStringHelper*>(reset));
+#endif
 }
\ No newline at end of file
@@ -1,9 +1,36 @@
 #ifndef DISPLAY_H
 #define DISPLAY_H
 
-#include <RGBmatrixPanel.h>
 #include <avr/pgmspace.h>
 
+/**
+ * @brief Drives the panel with PaletteMatrix instead of RGBmatrixPanel.
+ *
+ * When 1, the panel keeps a 4-bit palette index per pixel instead of every
+ * color bit plane, 2 KB per buffer for a 64x64 panel instead of 6 KB. The
+ * palette is displayColors, so the game draws exactly as before. Defined
+ * ahead of the panel include because it selects it.
+ */
+#ifndef DISPLAY_PALETTE_DRIVER
+#define DISPLAY_PALETTE_DRIVER 0
+#endif
+
+#if DISPLAY_PALETTE_DRIVER
+#include "PaletteMatrix.h"
+
+/**
+ * @brief Panel driver used by the game.
+ */
+typedef PaletteMatrix DisplayMatrix;
+#else
+#include <RGBmatrixPanel.h>
+
+/**
+ * @brief Panel driver used by the game.
+ */
+typedef RGBmatrixPanel DisplayMatrix;
+#endif
+
 /**
  * @brief Forward declaration of the Tetromino class.
  *
@@ -26,13 +53,72 @@ class Tetromino;
 #define D A3
 #define E A4
 
+/**
+ * @brief Enables tear-free double-buffered rendering.
+ *
+ * When 1, all drawing goes to a back buffer that becomes visible only when
+ * a frame ends. The panel library then allocates a second frame buffer of the
+ * same size, 6 KB for a 64x64 panel, which exceeds the RAM of an ATmega2560
+ * together with the first one. Enable it on boards with enough RAM, with a
+ * 32-row panel, or together with DISPLAY_PALETTE_DRIVER, whose buffers take
+ * 2 KB each. Boards with less than 16 KB of RAM refuse to build it without
+ * DISPLAY_PALETTE_DRIVER.
+ */
+#ifndef DISPLAY_DOUBLE_BUFFER
+#define DISPLAY_DOUBLE_BUFFER 0
+#endif
+
+#if DISPLAY_DOUBLE_BUFFER && !DISPLAY_PALETTE_DRIVER && defined(RAMEND) && \
+    RAMEND < 0x4000
+#error "DISPLAY_DOUBLE_BUFFER without DISPLAY_PALETTE_DRIVER needs 12 KB RAM"
+#endif
+
+/**
+ * @brief Draws the static screens from pre-rendered images.
+ *
+ * When 1, the title, HUD frame and game over screens are decoded from
+ * run-length encoded images in BakedScreens.h instead of being drawn glyph by
+ * glyph. BakedScreens.h is not part of the repository: generate it with the
+ * bake_screens tool in extras/host before enabling this flag. The tool builds
+ * with this flag set to 0 to render the screens the usual way, and needs the
+ * Adafruit GFX library for Fonts/FreeMonoBold9pt7b.h and Fonts/Picopixel.h.
+ */
+#ifndef DISPLAY_BAKED_SCREENS
+#define DISPLAY_BAKED_SCREENS 0
+#endif
+
+/**
+ * @brief Size of the pre-rendered screens in pixels, the size of the panel.
+ */
+#define SCREEN_WIDTH 64
+#define SCREEN_HEIGHT 64
+
+/**
+ * @brief Target duration of a frame in milliseconds (50 fps).
+ */
+#define FRAME_INTERVAL 20
+
+/**
+ * @brief Enables a once-per-second frame time report over Serial.
+ */
+#ifndef FRAME_REPORT
+#define FRAME_REPORT 0
+#endif
+
+/**
+ * @brief Number of frames summarized by a frame time report.
+ */
+#ifndef FRAME_REPORT_FRAMES
+#define FRAME_REPORT_FRAMES 50
+#endif
+
 /**
  * @brief Global instance of the RGB matrix panel.
  *
  * This instance provides access to display functionality and is externally
  * accessible.
  */
-extern RGBmatrixPanel matrix;
+extern DisplayMatrix matrix;
 
 /**
  * @brief Enum for defining display colors.
@@ -68,6 +154,14 @@ extern const uint16_t displayColors[NUM_COLORS] PROGMEM;
  * retrieving colors.
  */
 class Display {
+ private:
+  static uint32_t frameStartMicros;  ///< Start of the current frame in us.
+  static uint32_t frameTime;         ///< Duration of the last frame in us.
+  static uint32_t maxFrameTime;      ///< Longest frame of the report in us.
+  static uint32_t totalFrameTime;    ///< Sum of the frames of the report.
+  static uint16_t frameCount;        ///< Frames in the current report.
+  static uint16_t lateFrames;        ///< Frames of the report over budget.
+
  public:
   /**
    * @brief Retrieves the RGB value of a specified color.
@@ -83,8 +177,65 @@ class Display {
    * Sets up the display, clears it, and prepares it for rendering.
    */
   static void initDisplay();
+
+  /**
+   * @brief Starts a new frame.
+   *
+   * Called by the render task, which the scheduler runs every FRAME_INTERVAL
+   * milliseconds.
+   */
+  static void beginFrame();
+
+  /**
+   * @brief Finishes the current frame.
+   *
+   * In double-buffered mode, waits for the panel refresh to complete and
+   * shows the back buffer. Records how long the frame took.
+   */
+  static void endFrame();
+
+  /**
+   * @brief Shows everything drawn so far.
+   *
+   * Swaps the buffers in double-buffered mode and does nothing otherwise,
+   * since drawing then goes straight to the visible buffer.
+   */
+  static void present();
+
+  /**
+   * @brief Retrieves the duration of the last frame.
+   *
+   * @return The time from beginFrame to the end of endFrame in microseconds.
+   */
+  static uint32_t getFrameTime();
 };
 
+/**
+ * @brief Draws a 1bpp sprite stored in program memory.
+ *
+ * @param sprite The packed rows of the sprite, (width + 7) / 8 bytes each.
+ * @param width The width of the sprite in pixels.
+ * @param height The height of the sprite in pixels.
+ * @param x The x-coordinate of the sprite's top left corner.
+ * @param y The y-coordinate of the sprite's top left corner.
+ * @param color The color of the sprite or the first gradient color.
+ * @param gradientRows Rows per rainbow gradient color, 0 for a single color.
+ */
+void drawSprite(const uint8_t* sprite, uint8_t width, uint8_t height,
+                uint8_t x, uint8_t y, Colors color, uint8_t gradientRows = 0);
+
+/**
+ * @brief Draws a pre-rendered screen stored in program memory.
+ *
+ * The screen is a sequence of runs in row-major order that covers all
+ * SCREEN_WIDTH * SCREEN_HEIGHT pixels. Each run starts with a byte holding
+ * the Colors index in the high nibble and the run length minus one in the
+ * low nibble; a low nibble of 15 means the length is 16 plus the next byte.
+ *
+ * @param screen The encoded runs of the screen.
+ */
+void drawScreen(const uint8_t* screen);
+
 /**
  * @brief Draws the static elements of the game interface on the display.
  */
@@ -4,25 +4,11 @@
 #include <DFRobotDFPlayerMini.h>
 
 #include "Board.h"
+#include "Profiler.h"
 
-// extern HardwareSerial Serial;
 extern HardwareSerial
     Serial1;  ///< Serial interface for MP3 player communication.
 
-// extern unsigned int __bss_end;
-// extern unsigned int __heap_start;
-// extern void* __brkval;
-
-// int freeMemory() {
-//   int free_memory;
-//   if ((int)__brkval == 0) {
-//     free_memory = ((int)&free_memory) - ((int)&__bss_end);
-//   } else {
-//     free_memory = ((int)&free_memory) - ((int)__brkval);
-//   }
-//   return free_memory;
-// }
-
 /**
  * @brief Constructor for the Game class.
  *
@@ -35,12 +21,15 @@ Game::Game()
       clearedRows(0),
       totalClearedRows(0),
       fallSpeed(500),
-      lastFallTime(0),
+      fallTime(0),
       isPaused(false),
       gameOver(false),
       board(),
       currentTetromino(nullptr),
-      nextTetromino(nullptr) {}
+      nextTetromino(nullptr),
+      pieceRenderer(),
+      ghostPiece(),
+      lineClearEffect() {}
 
 /**
  * @brief Destructor for the Game class.
@@ -48,10 +37,13 @@ Game::Game()
  * Frees dynamically allocated memory for Tetromino objects.
  */
 Game::~Game() {
+  // After a game over, both pointers refer to the same Tetromino
+  if (nextTetromino != currentTetromino) {
+    delete nextTetromino;
+  }
+  nextTetromino = nullptr;
   delete currentTetromino;
   currentTetromino = nullptr;
-  delete nextTetromino;
-  nextTetromino = nullptr;
 }
 
 /**
@@ -135,16 +127,14 @@ Tetromino* Game::createTetromino() {
 }
 
 /**
- * @brief Initializes the game.
+ * @brief Sets up the buzzer, the random generator and the MP3 player.
  *
- * This method sets up the display, the controller, and initializes all
- * relevant game variables. The game waits for player input before starting.
+ * Called once at startup. Starting the MP3 player takes a while, so it is
+ * not repeated for every game.
  */
-void Game::init() {
+void Game::begin() {
   pinMode(BUZZER_PIN, OUTPUT);
 
-  uint32_t startTime = millis();
-
   randomSeed(analogRead(A5));  // Seed the random generator
 
   // Initialize the MP3 player
@@ -153,6 +143,15 @@ void Game::init() {
     while (true);
   }
   mp3Player.volume(20);
+}
+
+/**
+ * @brief Initializes the game.
+ *
+ * Starts the background music, draws the game interface and creates the
+ * first Tetrominos.
+ */
+void Game::init() {
   mp3Player.play(1);
 
   drawStaticElements();
@@ -163,53 +162,76 @@ void Game::init() {
 
   // Initialize Tetrominos
   currentTetromino = createTetromino();
-  currentTetromino->setOffset(13, 17);
+  currentTetromino->setOffset(Board::SPAWN_X, Board::SPAWN_Y);
   nextTetromino = createTetromino();
   updateNextTetrominoDisplay(*nextTetromino);
 }
 
 /**
- * @brief Executes the main game loop.
+ * @brief Advances the game by one logic tick.
  *
- * Handles Tetromino movement, collision checking, row clearing, and player
- * inputs.
+ * Handles Tetromino falling, collision checking and row clearing. The fall
+ * timer counts GAME_TICK milliseconds per tick instead of reading the clock,
+ * so late ticks do not shift the following fall steps.
  */
 void Game::run() {
-  uint32_t lastMemoryCheck = 0;
-
-  if (mp3Player.available() && mp3Player.readType() == DFPlayerPlayFinished) {
-    mp3Player.play(1);
-  }
-
   uint32_t currentTime = millis();
 
-  updateSounds();
-
   if (isPaused) {
     return;
   }
 
+  // The next Tetromino starts falling once the line clear animation ended
+  if (lineClearEffect.isActive()) {
+    fallTime = 0;
+    return;
+  }
+
   // Handle Tetromino falling
-  if (currentTime - lastFallTime >= fallSpeed) {
-    currentTetromino->clear(currentTetromino->getOffsetX(),
-                            currentTetromino->getOffsetY());
-    if (!currentTetromino->moveDown(
-            board)) {  // Check if Tetromino can move further
-      board.placeTetromino(*currentTetromino);
-
-      uint8_t rowsCleared = board.clearFullLines();
+  fallTime += GAME_TICK;
+  if (fallTime >= fallSpeed) {
+    bool moved;
+    {
+      PROFILE_SCOPE(PROFILE_GRAVITY);
+      moved = currentTetromino->moveDown(board);
+    }
+
+    if (!moved) {  // The Tetromino cannot move further
+      {
+        PROFILE_SCOPE(PROFILE_PLACEMENT);
+
+        // Catch up with moves made since the last frame, then the board owns
+        // the drawn cells
+        pieceRenderer.flush(*currentTetromino);
+        ghostPiece.flush(board, *currentTetromino);
+        board.placeTetromino(*currentTetromino);
+        pieceRenderer.reset();
+        ghostPiece.reset();
+      }
+
+      uint8_t rowsCleared;
+      {
+        PROFILE_SCOPE(PROFILE_LINE_CLEAR);
+        rowsCleared = board.clearFullLines();
+      }
+      if (rowsCleared > 0) {
+        lineClearEffect.start(board.getClearedRows(), currentTime);
+      }
       totalClearedRows += rowsCleared;
       clearedRows += rowsCleared;
-      updateScore(rowsCleared);
-      updateLinesDisplay(totalClearedRows);
-      updateLevelAndSpeed();
+      {
+        PROFILE_SCOPE(PROFILE_HUD);
+        updateScore(rowsCleared);
+        updateLinesDisplay(totalClearedRows);
+        updateLevelAndSpeed();
+      }
 
       delete currentTetromino;
       currentTetromino = nullptr;
 
       currentTetromino = nextTetromino;
       forceHeapReset();
-      currentTetromino->setOffset(13, 17);
+      currentTetromino->setOffset(Board::SPAWN_X, Board::SPAWN_Y);
 
       // Check if the game is over
       if (board.checkCollision(*currentTetromino,
@@ -218,36 +240,49 @@ void Game::run() {
                                currentTetromino->getRotation())) {
         gameOverDisplay();
         mp3Player.stop();
-        mp3Player.reset();
         gameOver = true;
 
-        // Play game-over sound
-        const uint16_t frequencies[] = {1200, 1000, 800};
-        const uint16_t soundDurations[] = {300, 300, 800};
-
-        for (uint8_t i = 0; i < 3; i++) {
-          tone(BUZZER_PIN, frequencies[i]);
-          delay(soundDurations[i]);
-          noTone(BUZZER_PIN);
-        }
+        // Play the game-over sound instead of any other sound effect
+        isRowClearSound = false;
+        isLevelUpSound = false;
+        levelUpDelay = false;
+        isGameOverSound = true;
+        gameOverSoundStep = 0;
 
         return;
       }
 
       // Prepare the next Tetromino
       nextTetromino = createTetromino();
+
+      PROFILE_SCOPE(PROFILE_HUD);
       updateNextTetrominoDisplay(*nextTetromino);
     }
-    currentTetromino->draw(currentTetromino->getOffsetX(),
-                           currentTetromino->getOffsetY());
-    lastFallTime = currentTime;
+    fallTime = 0;
   }
+}
 
-  // if (currentTime - lastMemoryCheck >= 1000) {
-  //   Serial.print("Freier Speicher: ");
-  //   Serial.println(freeMemory());
-  //   lastMemoryCheck = currentTime;
-  // }
+/**
+ * @brief Renders the changes since the last frame.
+ *
+ * Draws the moves of the current Tetromino and its ghost into the shadow
+ * buffer and pushes the changed board cells to the display in one go. Nothing
+ * is drawn while the pause or game over screen is shown.
+ */
+void Game::render() {
+  if (isPaused || gameOver) {
+    return;
+  }
+
+  // The current Tetromino stays hidden until the cleared lines collapsed
+  if (lineClearEffect.isActive()) {
+    lineClearEffect.update(board, millis());
+  }
+  if (!lineClearEffect.isActive()) {
+    pieceRenderer.flush(*currentTetromino);
+    ghostPiece.flush(board, *currentTetromino);
+  }
+  Board::getShadow().flush();
 }
 
 /**
@@ -262,34 +297,49 @@ void Game::keyAction(char key) {
   Tetromino& currentTetromino = *this->currentTetromino;
   Board& board = this->board;
 
-  currentTetromino.clear(currentTetromino.getOffsetX(),
-                         currentTetromino.getOffsetY());
+  // Moves only update the Tetromino; render() draws the changed cells. The
+  // Tetromino cannot move before the line clear animation ended.
+  bool canMove = !lineClearEffect.isActive();
 
   switch (key) {
     case '6':
-      currentTetromino.moveLeft(board);
+      if (canMove) currentTetromino.moveLeft(board);
       break;
     case '5':
-      currentTetromino.rotate(board);
+      if (canMove) currentTetromino.rotate(board);
       break;
     case '4':
-      currentTetromino.moveRight(board);
+      if (canMove) currentTetromino.moveRight(board);
       break;
     case '2':
-      currentTetromino.moveDown(board);
+      if (canMove) currentTetromino.moveDown(board);
       break;
     case 'B':
       togglePause();
       break;
     case '#':
-      mp3Player.volumeUp();
+      volumeUp();
       break;
     case '*':
-      mp3Player.volumeDown();
+      volumeDown();
       break;
   }
 }
 
+/**
+ * @brief Raises the volume of the MP3 player by one step.
+ *
+ * Needs no running game, so the front end can call it in every state.
+ */
+void Game::volumeUp() { mp3Player.volumeUp(); }
+
+/**
+ * @brief Lowers the volume of the MP3 player by one step.
+ *
+ * Needs no running game, so the front end can call it in every state.
+ */
+void Game::volumeDown() { mp3Player.volumeDown(); }
+
 /**
  * @brief Updates the score based on the number of cleared rows.
  *
@@ -423,6 +473,34 @@ void Game::levelUpSound() {
   }
 }
 
+/**
+ * @brief Plays the sound effect for the end of the game.
+ *
+ * This method produces a sequence of three descending tones, the last one
+ * held longer. The first tone starts right away, each following one when the
+ * previous one has played for its duration.
+ *
+ * After completing the sequence, the sound effect ends.
+ */
+void Game::gameOverSound() {
+  const uint16_t frequencies[] = {1200, 1000, 800};
+  const uint16_t soundDurations[] = {300, 300, 800};
+
+  if (gameOverSoundStep > 0 && millis() - gameOverSoundStartTime <
+                                   soundDurations[gameOverSoundStep - 1]) {
+    return;
+  }
+  gameOverSoundStartTime = millis();
+
+  if (gameOverSoundStep < 3) {
+    tone(BUZZER_PIN, frequencies[gameOverSoundStep]);
+  } else {
+    noTone(BUZZER_PIN);
+    isGameOverSound = false;
+  }
+  gameOverSoundStep++;
+}
+
 /**
  * @brief Manages all game sound effects.
  *
@@ -430,11 +508,19 @@ void Game::levelUpSound() {
  * based on the current game state. It ensures that only one sound effect is
  * active at a time and manages any required delays.
  *
+ * - If `isGameOverSound` is true, the game-over sound is played.
  * - If `isRowClearSound` is true, the row clear sound is played.
  * - If `levelUpDelay` is true, it triggers the level-up sound effect.
  * - If `isLevelUpSound` is true, the level-up sound effect is played.
  */
 void Game::updateSounds() {
+  PROFILE_SCOPE(PROFILE_AUDIO);
+
+  if (isGameOverSound) {
+    gameOverSound();
+    return;
+  }
+
   if (isRowClearSound) {
     rowClearSound();
     return;
@@ -453,6 +539,20 @@ void Game::updateSounds() {
   }
 }
 
+/**
+ * @brief Restarts the background music when the track finished.
+ *
+ * Reads the messages of the MP3 player; the background track is played in a
+ * loop.
+ */
+void Game::pollPlayer() {
+  PROFILE_SCOPE(PROFILE_PLAYER);
+
+  if (mp3Player.available() && mp3Player.readType() == DFPlayerPlayFinished) {
+    mp3Player.play(1);
+  }
+}
+
 /**
  * @brief Toggles between paused and running states of the game.
  *
@@ -472,12 +572,13 @@ void Game::togglePause() {
     updateLinesDisplay(totalClearedRows);
     updateNextTetrominoDisplay(*nextTetromino);
 
-    // Redraw the board and the current Tetromino
+    // Redraw the board; the next frame redraws the current Tetromino
     board.draw();
-
-    currentTetromino->draw(currentTetromino->getOffsetX(),
-                           currentTetromino->getOffsetY());
   }
+
+  pieceRenderer.reset();
+  ghostPiece.reset();
+  lineClearEffect.cancel();
 }
 
 /**
@@ -486,9 +587,6 @@ void Game::togglePause() {
  * Clears the game board, resets all variables, and prepares for a new game.
  */
 void Game::resetGame() {
-  // Serial.print("Before reset, free memory: ");
-  // Serial.println(freeMemory());
-
   // Delete existing Tetromino objects
   if (currentTetromino == nextTetromino) {
     delete currentTetromino;
@@ -508,6 +606,9 @@ void Game::resetGame() {
   forceHeapReset();
 
   board.clear();
+  pieceRenderer.reset();
+  ghostPiece.reset();
+  lineClearEffect.cancel();
 
   // Reset game variables
   level = 1;
@@ -515,12 +616,16 @@ void Game::resetGame() {
   totalClearedRows = 0;
   clearedRows = 0;
   fallSpeed = 1000;
-  lastFallTime = 0;
+  fallTime = 0;
   isPaused = false;
   gameOver = false;
 
-  // Serial.print("After reset, free memory: ");
-  // Serial.println(freeMemory());
+  // A new game may start while a sound effect still plays
+  noTone(BUZZER_PIN);
+  isRowClearSound = false;
+  isLevelUpSound = false;
+  levelUpDelay = false;
+  isGameOverSound = false;
 }
 
 /**
@@ -4,9 +4,30 @@
 #include <DFRobotDFPlayerMini.h>
 
 #include "Board.h"
+#include "GhostPiece.h"
+#include "LineClearEffect.h"
+#include "PieceRenderer.h"
 
 #define BUZZER_PIN 8  ///< Pin number for the buzzer used in the game sounds.
 
+/**
+ * @brief Duration of a logic tick in milliseconds.
+ *
+ * Gravity counts in ticks, so fall steps stay on an exact grid regardless of
+ * when the scheduler gets to run the tick. Fall speeds are multiples of it.
+ */
+#define GAME_TICK 10
+
+/**
+ * @brief Time between two updates of the sound effects in milliseconds.
+ */
+#define SOUND_PERIOD 10
+
+/**
+ * @brief Time between two polls of the MP3 player in milliseconds.
+ */
+#define PLAYER_POLL_PERIOD 100
+
 /**
  * @brief The Game class manages the main gameplay logic for a Tetris game.
  *
@@ -20,12 +41,15 @@ class Game {
   Board board;                  ///< The game board object.
   Tetromino* currentTetromino;  ///< Pointer to the currently active Tetromino.
   Tetromino* nextTetromino;     ///< Pointer to the next Tetromino.
+  PieceRenderer pieceRenderer;  ///< Draws the changes of the current Tetromino.
+  GhostPiece ghostPiece;        ///< Shows where the current Tetromino lands.
+  LineClearEffect lineClearEffect;  ///< Animates the last cleared lines.
   uint16_t score;               ///< Current game score.
   uint8_t level;                ///< Current game level.
   uint16_t clearedRows;       ///< Number of rows cleared in the current level.
   uint16_t totalClearedRows;  ///< Total number of rows cleared in the game.
   uint16_t fallSpeed;         ///< Speed at which Tetrominos fall (ms per step).
-  uint32_t lastFallTime;      ///< Timestamp of the last fall step.
+  uint16_t fallTime;          ///< Game time since the last fall step in ms.
 
   bool isPaused;  ///< Indicates if the game is currently paused.
   bool gameOver;  ///< Indicates if the game is over.
@@ -41,6 +65,10 @@ class Game {
   uint32_t levelUpSoundStartTime = 0;
   uint16_t levelUpSoundStep = 0;
 
+  bool isGameOverSound = false;
+  uint32_t gameOverSoundStartTime = 0;
+  uint8_t gameOverSoundStep = 0;
+
   /**
    * @brief Creates a new Tetromino with a random type and color.
    *
@@ -71,9 +99,9 @@ class Game {
   void levelUpSound();
 
   /**
-   * @brief Updates and manages all game sounds.
+   * @brief Handles the sound effect for the end of the game.
    */
-  void updateSounds();
+  void gameOverSound();
 
  public:
   /**
@@ -90,21 +118,48 @@ class Game {
    */
   ~Game();
 
+  /**
+   * @brief Sets up the buzzer, the random generator and the MP3 player.
+   *
+   * Called once at startup, before the first game.
+   */
+  void begin();
+
   /**
    * @brief Initializes the game.
    *
-   * Sets up the game board, controls, and display, and waits for a start input.
+   * Starts the music and draws the game interface for a new game.
    */
   void init();
 
   /**
-   * @brief Executes the main game loop.
+   * @brief Advances the game by one logic tick of GAME_TICK milliseconds.
    *
-   * Controls Tetromino movement, updates game states, and processes player
-   * input.
+   * Lets the current Tetromino fall, locks it, and clears full lines.
    */
   void run();
 
+  /**
+   * @brief Updates and manages all game sounds.
+   *
+   * Called every SOUND_PERIOD milliseconds.
+   */
+  void updateSounds();
+
+  /**
+   * @brief Restarts the background music when the track finished.
+   *
+   * Called every PLAYER_POLL_PERIOD milliseconds.
+   */
+  void pollPlayer();
+
+  /**
+   * @brief Renders the changes since the last frame.
+   *
+   * Called once per frame by the game loop.
+   */
+  void render();
+
   /**
    * @brief Processes player input based on the pressed key.
    *
@@ -112,6 +167,16 @@ class Game {
    */
   void keyAction(char key);
 
+  /**
+   * @brief Raises the volume of the MP3 player by one step.
+   */
+  void volumeUp();
+
+  /**
+   * @brief Lowers the volume of the MP3 player by one step.
+   */
+  void volumeDown();
+
   /**
    * @brief Toggles the game's pause state.
    */
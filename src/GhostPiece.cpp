@@ -0,0 +1,128 @@
+#include "GhostPiece.h"
+
+#include "PieceRenderer.h"
+#include "Tetromino.h"
+
+/**
+ * @brief Constructor for the GhostPiece class.
+ *
+ * Starts without any drawn cells and without a cached landing row.
+ */
+GhostPiece::GhostPiece()
+    : landingX(0),
+      landingRotation(0),
+      landingRow(0),
+      landingValid(false),
+      drawnX(0),
+      drawnY(0),
+      drawnMask(0) {}
+
+/**
+ * @brief Computes the landing row of the Tetromino.
+ *
+ * Uses the column heights of the board, which assumes the Tetromino drops
+ * from above the stack. A Tetromino already at or below that row was slid
+ * under an overhang; then it is stepped down from its current row instead.
+ *
+ * @param board The board the Tetromino falls on.
+ * @param tetromino The falling Tetromino.
+ * @return The board row at which the Tetromino comes to rest.
+ */
+int8_t GhostPiece::findLandingRow(Board& board, const Tetromino& tetromino) {
+  uint8_t x = tetromino.getOffsetX();
+  uint8_t rotation = tetromino.getRotation();
+  uint8_t landingY = board.getLandingY(tetromino, x, rotation);
+
+  if (Board::toRow(tetromino.getOffsetY()) < Board::toRow(landingY)) {
+    return Board::toRow(landingY);
+  }
+
+  uint8_t y = tetromino.getOffsetY();
+  while (!board.checkCollision(tetromino, x, y + Board::SCALE, rotation)) {
+    y += Board::SCALE;
+  }
+
+  return Board::toRow(y);
+}
+
+/**
+ * @brief Brings the ghost on the display up to date with the Tetromino.
+ *
+ * The ghost consists of the cells of the Tetromino's shape at the landing
+ * row that the Tetromino does not cover itself. Ghost cells that are gone are
+ * erased unless the Tetromino covers them now, and ghost cells that are new
+ * are drawn.
+ *
+ * @param board The board the Tetromino falls on.
+ * @param tetromino The falling Tetromino.
+ */
+void GhostPiece::flush(Board& board, const Tetromino& tetromino) {
+  int8_t x = Board::toColumn(tetromino.getOffsetX());
+  int8_t pieceY = Board::toRow(tetromino.getOffsetY());
+  uint16_t shape =
+      Tetromino::getShape(tetromino.getType(), tetromino.getRotation()).mask;
+
+  // The landing row stays valid until the Tetromino moves sideways, rotates,
+  // or falls past it
+  if (!landingValid || tetromino.getOffsetX() != landingX ||
+      tetromino.getRotation() != landingRotation || pieceY > landingRow) {
+    landingRow = findLandingRow(board, tetromino);
+    landingX = tetromino.getOffsetX();
+    landingRotation = tetromino.getRotation();
+    landingValid = true;
+  }
+
+  // Leave out the cells the Tetromino covers itself
+  int8_t y = landingRow;
+  uint16_t mask = 0;
+  for (uint8_t cell = 0; cell < 16; cell++) {
+    if ((shape & (1 << cell)) &&
+        !PieceRenderer::covers(x, pieceY, shape, x + cell % 4,
+                               y + cell / 4)) {
+      mask |= 1 << cell;
+    }
+  }
+
+  if (x == drawnX && y == drawnY && mask == drawnMask) {
+    return;
+  }
+
+  // Old minus new: ghost cells that are gone, unless the Tetromino took them
+  uint16_t cells = drawnMask;
+  for (uint8_t cell = 0; cells != 0; cell++, cells >>= 1) {
+    if (cells & 1) {
+      int8_t cellX = drawnX + cell % 4;
+      int8_t cellY = drawnY + cell / 4;
+
+      if (!PieceRenderer::covers(x, y, mask, cellX, cellY) &&
+          !PieceRenderer::covers(x, pieceY, shape, cellX, cellY)) {
+        Board::drawCell(cellX, cellY, BLACK);
+      }
+    }
+  }
+
+  // New minus old: ghost cells that appeared
+  cells = mask;
+  for (uint8_t cell = 0; cells != 0; cell++, cells >>= 1) {
+    if (cells & 1) {
+      int8_t cellX = x + cell % 4;
+      int8_t cellY = y + cell / 4;
+
+      if (!PieceRenderer::covers(drawnX, drawnY, drawnMask, cellX, cellY)) {
+        Board::drawCell(cellX, cellY, GHOST_COLOR);
+      }
+    }
+  }
+
+  drawnX = x;
+  drawnY = y;
+  drawnMask = mask;
+}
+
+/**
+ * @brief Forgets the drawn cells and the cached landing row.
+ */
+void GhostPiece::reset() {
+  drawnMask = 0;
+  landingValid = false;
+}
@@ -0,0 +1,68 @@
+#ifndef GHOST_PIECE_H
+#define GHOST_PIECE_H
+
+#include "Board.h"
+
+/**
+ * @brief Palette color of the ghost piece.
+ */
+#define GHOST_COLOR GRAY
+
+/**
+ * @brief Shows where the falling Tetromino will land.
+ *
+ * The landing row only depends on the column and the rotation of the
+ * Tetromino while the board stays the same, so it is cached and recomputed
+ * only when one of them changes. Like the PieceRenderer, the ghost remembers
+ * the cells it drew and each flush only touches the cells that differ from
+ * the last frame. Cells covered by the Tetromino itself are left to the
+ * PieceRenderer.
+ */
+class GhostPiece {
+ private:
+  uint8_t landingX;         ///< X-coordinate the landing row belongs to.
+  uint8_t landingRotation;  ///< Rotation the landing row belongs to.
+  int8_t landingRow;        ///< Cached board row of the landing position.
+  bool landingValid;        ///< Whether the cached landing row is usable.
+
+  int8_t drawnX;       ///< Board column of the drawn shape grid.
+  int8_t drawnY;       ///< Board row of the drawn shape grid.
+  uint16_t drawnMask;  ///< Ghost cells drawn last, 0 when nothing is drawn.
+
+  /**
+   * @brief Computes the landing row of the Tetromino.
+   *
+   * @param board The board the Tetromino falls on.
+   * @param tetromino The falling Tetromino.
+   * @return The board row at which the Tetromino comes to rest.
+   */
+  static int8_t findLandingRow(Board& board, const Tetromino& tetromino);
+
+ public:
+  /**
+   * @brief Constructor for the GhostPiece class.
+   *
+   * Starts without any drawn cells and without a cached landing row.
+   */
+  GhostPiece();
+
+  /**
+   * @brief Brings the ghost on the display up to date with the Tetromino.
+   *
+   * Meant to be called once per frame after the PieceRenderer was flushed.
+   *
+   * @param board The board the Tetromino falls on.
+   * @param tetromino The falling Tetromino.
+   */
+  void flush(Board& board, const Tetromino& tetromino);
+
+  /**
+   * @brief Forgets the drawn cells and the cached landing row.
+   *
+   * Called when the board or the current Tetromino changed, or when the
+   * screen was redrawn. The next flush draws the ghost in full.
+   */
+  void reset();
+};
+
+#endif
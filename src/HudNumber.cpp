@@ -0,0 +1,104 @@
+#include "HudNumber.h"
+
+#include <avr/pgmspace.h>
+
+#include "Display.h"
+
+/**
+ * @brief Glyph index of an empty digit position.
+ */
+#define BLANK_GLYPH 10
+
+/**
+ * @brief Digit glyphs 0-9 followed by a blank glyph, stored in program
+ * memory.
+ *
+ * Every glyph consists of HUD_DIGIT_WIDTH columns; bit 0 of a column is its
+ * top pixel.
+ */
+const uint8_t DIGIT_GLYPHS[11][HUD_DIGIT_WIDTH] PROGMEM = {
+    {0x3E, 0x51, 0x49, 0x45, 0x3E},  // 0
+    {0x00, 0x42, 0x7F, 0x40, 0x00},  // 1
+    {0x72, 0x49, 0x49, 0x49, 0x46},  // 2
+    {0x21, 0x41, 0x49, 0x4D, 0x33},  // 3
+    {0x18, 0x14, 0x12, 0x7F, 0x10},  // 4
+    {0x27, 0x45, 0x45, 0x45, 0x39},  // 5
+    {0x3C, 0x4A, 0x49, 0x49, 0x31},  // 6
+    {0x41, 0x21, 0x11, 0x09, 0x07},  // 7
+    {0x36, 0x49, 0x49, 0x49, 0x36},  // 8
+    {0x46, 0x49, 0x49, 0x29, 0x1E},  // 9
+    {0x00, 0x00, 0x00, 0x00, 0x00}   // blank
+};
+
+/**
+ * @brief Constructor for the HudNumber class.
+ *
+ * Starts with all digits blank, matching a cleared screen.
+ *
+ * @param digitCount The number of digits, at most HUD_MAX_DIGITS.
+ */
+HudNumber::HudNumber(uint8_t digitCount)
+    : digitCount(min(digitCount, HUD_MAX_DIGITS)) {
+  reset();
+}
+
+/**
+ * @brief Replaces a glyph on the display.
+ *
+ * Compares the glyphs column by column and draws only the pixels that differ:
+ * pixels of the new glyph in the digit color, pixels of the old glyph in
+ * black.
+ *
+ * @param x The x-coordinate of the glyph.
+ * @param y The y-coordinate of the glyph.
+ * @param oldGlyph The glyph currently on the display.
+ * @param newGlyph The glyph to show.
+ * @param color The color of the digit.
+ */
+void HudNumber::drawGlyph(uint8_t x, uint8_t y, uint8_t oldGlyph,
+                          uint8_t newGlyph, uint16_t color) {
+  for (uint8_t col = 0; col < HUD_DIGIT_WIDTH; col++) {
+    uint8_t oldBits = pgm_read_byte(&DIGIT_GLYPHS[oldGlyph][col]);
+    uint8_t newBits = pgm_read_byte(&DIGIT_GLYPHS[newGlyph][col]);
+    uint8_t changed = oldBits ^ newBits;
+
+    for (uint8_t row = 0; changed != 0; row++, changed >>= 1, newBits >>= 1) {
+      if (changed & 1) {
+        matrix.drawPixel(x + col, y + row,
+                         newBits & 1 ? color : Display::getColor(BLACK));
+      }
+    }
+  }
+}
+
+/**
+ * @brief Shows a value, redrawing only the digits that changed.
+ *
+ * Splits the value into zero-padded decimal digits, starting with the least
+ * significant one, and skips every digit that is already on the display.
+ *
+ * @param x The x-coordinate of the leftmost digit.
+ * @param y The y-coordinate of the top of the digits.
+ * @param value The value to show; higher digits are cut off.
+ * @param color The color of the digits.
+ */
+void HudNumber::draw(uint8_t x, uint8_t y, uint16_t value, uint16_t color) {
+  for (int8_t i = digitCount - 1; i >= 0; i--) {
+    uint8_t digit = value % 10;
+    value /= 10;
+
+    if (shown[i] != digit) {
+      drawGlyph(x + i * HUD_DIGIT_ADVANCE, y, shown[i], digit, color);
+      shown[i] = digit;
+    }
+  }
+}
+
+/**
+ * @brief Records that the digits were erased from the display.
+ */
+void HudNumber::reset() {
+  for (uint8_t i = 0; i < HUD_MAX_DIGITS; i++) {
+    shown[i] = BLANK_GLYPH;
+  }
+}
@@ -0,0 +1,72 @@
+#ifndef HUD_NUMBER_H
+#define HUD_NUMBER_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Dimensions of a HUD digit glyph in pixels.
+ *
+ * The glyphs match the digits of the Adafruit_GFX classic font, so the HUD
+ * looks the same as text printed with the default font.
+ */
+#define HUD_DIGIT_WIDTH 5
+#define HUD_DIGIT_HEIGHT 7
+#define HUD_DIGIT_ADVANCE 6
+
+/**
+ * @brief Maximum number of digits a HudNumber can show.
+ */
+#define HUD_MAX_DIGITS 5
+
+/**
+ * @brief A zero-padded number on the HUD that redraws only changed digits.
+ *
+ * Remembers the digits currently on the display. When a new value is shown,
+ * unchanged digits are skipped and a changed digit only writes the pixels in
+ * which the old and the new glyph differ.
+ */
+class HudNumber {
+ private:
+  uint8_t digitCount;             ///< Number of digits shown.
+  uint8_t shown[HUD_MAX_DIGITS];  ///< Glyphs on the display, left to right.
+
+  /**
+   * @brief Replaces a glyph on the display.
+   *
+   * @param x The x-coordinate of the glyph.
+   * @param y The y-coordinate of the glyph.
+   * @param oldGlyph The glyph currently on the display.
+   * @param newGlyph The glyph to show.
+   * @param color The color of the digit.
+   */
+  static void drawGlyph(uint8_t x, uint8_t y, uint8_t oldGlyph,
+                        uint8_t newGlyph, uint16_t color);
+
+ public:
+  /**
+   * @brief Constructor for the HudNumber class.
+   *
+   * @param digitCount The number of digits, at most HUD_MAX_DIGITS.
+   */
+  HudNumber(uint8_t digitCount);
+
+  /**
+   * @brief Shows a value, redrawing only the digits that changed.
+   *
+   * @param x The x-coordinate of the leftmost digit.
+   * @param y The y-coordinate of the top of the digits.
+   * @param value The value to show; higher digits are cut off.
+   * @param color The color of the digits.
+   */
+  void draw(uint8_t x, uint8_t y, uint16_t value, uint16_t color);
+
+  /**
+   * @brief Records that the digits were erased from the display.
+   *
+   * Called after the screen was cleared, so the next draw renders every
+   * digit again.
+   */
+  void reset();
+};
+
+#endif
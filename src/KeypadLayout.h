@@ -0,0 +1,41 @@
+#ifndef KEYPAD_LAYOUT_H
+#define KEYPAD_LAYOUT_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Defines the number of rows and columns for the keypad.
+ */
+#define KEYPAD_ROWS 4
+#define KEYPAD_COLS 4
+
+/**
+ * @brief Key mapping for the keypad.
+ *
+ * Maps each button on the 4x4 keypad to a character. These characters
+ * represent the keys available to the player.
+ */
+const char keymap[KEYPAD_ROWS][KEYPAD_COLS] = {{'1', '2', '3', 'A'},
+                                               {'7', '8', '9', 'C'},
+                                               {'4', '5', '6', 'B'},
+                                               {'*', '0', '#', 'D'}};
+
+/**
+ * @brief Pin configuration for the keypad rows and columns.
+ *
+ * Defines which microcontroller pins are connected to the rows and columns
+ * of the keypad.
+ */
+const byte rowPins[KEYPAD_ROWS] = {37, 39, 41, 43};
+const byte colPins[KEYPAD_COLS] = {45, 47, 49, 51};
+
+/**
+ * @brief A press or release of a key.
+ */
+struct KeyEvent {
+  char key;       ///< The character of the key.
+  bool pressed;   ///< True for a press, false for a release.
+  uint32_t time;  ///< The time of the press or release in microseconds.
+};
+
+#endif
@@ -0,0 +1,203 @@
+#include "Controller.h"
+
+#if KEYPAD_SCAN_ISR
+
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+static_assert((KEYPAD_QUEUE_SIZE & (KEYPAD_QUEUE_SIZE - 1)) == 0,
+              "KEYPAD_QUEUE_SIZE must be a power of two");
+
+/**
+ * @brief Keeps the compiler from moving memory accesses across this point.
+ *
+ * The queue slots are not volatile, so without it an event could be read
+ * before the head that publishes it, or written after.
+ */
+#define KEYPAD_BARRIER() __asm__ __volatile__("" ::: "memory")
+
+/**
+ * @brief The keypad scanned by the Timer3 compare A interrupt.
+ */
+static KeypadScanner* activeScanner = nullptr;
+
+/**
+ * @brief Constructor for the KeypadScanner class.
+ */
+KeypadScanner::KeypadScanner() : head(0), tail(0), stableKeys(0) {}
+
+/**
+ * @brief Configures the pins and starts the scan interrupt.
+ *
+ * The rows are inputs with pull-ups. The columns are inputs without pull-ups
+ * while idle, so setting their mode bit drives them low. Timer3 runs with a
+ * prescaler of 64 in CTC mode, since Timer1 refreshes the panel and Timer2
+ * plays the tones.
+ */
+void KeypadScanner::begin() {
+  for (uint8_t row = 0; row < KEYPAD_ROWS; row++) {
+    pinMode(rowPins[row], INPUT_PULLUP);
+    rowInputs[row] = portInputRegister(digitalPinToPort(rowPins[row]));
+    rowMasks[row] = digitalPinToBitMask(rowPins[row]);
+  }
+  for (uint8_t col = 0; col < KEYPAD_COLS; col++) {
+    pinMode(colPins[col], INPUT);
+    colModes[col] = portModeRegister(digitalPinToPort(colPins[col]));
+    colMasks[col] = digitalPinToBitMask(colPins[col]);
+  }
+
+  stableKeys = readKeys();
+  memset(counts, 0, sizeof(counts));
+  head = 0;
+  tail = 0;
+
+  activeScanner = this;
+
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+    TCCR3A = 0;
+    TCCR3B = _BV(WGM32) | _BV(CS31) | _BV(CS30);
+    OCR3A = F_CPU / 64 / 1000 * KEYPAD_SCAN_PERIOD - 1;
+    TCNT3 = 0;
+    TIMSK3 |= _BV(OCIE3A);
+  }
+}
+
+/**
+ * @brief Reads which keys are down, without debouncing.
+ *
+ * Bit row * KEYPAD_COLS + col stands for the key at that position of the
+ * keymap.
+ *
+ * @return One bit per key, set if the key is down.
+ */
+uint16_t KeypadScanner::readKeys() {
+  uint16_t keys = 0;
+
+  for (uint8_t col = 0; col < KEYPAD_COLS; col++) {
+    *colModes[col] |= colMasks[col];
+    delayMicroseconds(KEYPAD_SETTLE_US);
+
+    for (uint8_t row = 0; row < KEYPAD_ROWS; row++) {
+      if (!(*rowInputs[row] & rowMasks[row])) {
+        keys |= 1U << (row * KEYPAD_COLS + col);
+      }
+    }
+
+    *colModes[col] &= ~colMasks[col];
+  }
+  return keys;
+}
+
+/**
+ * @brief Queues an event, or drops it if the queue is full.
+ *
+ * The slot is filled before the head moves past it, so the main loop never
+ * reads a partly written event.
+ *
+ * @param key The character of the key.
+ * @param pressed True for a press, false for a release.
+ * @param time The time of the change in microseconds.
+ */
+void KeypadScanner::push(char key, bool pressed, uint32_t time) {
+  uint8_t index = head;
+  uint8_t next = (index + 1) & (KEYPAD_QUEUE_SIZE - 1);
+
+  if (next == tail) {
+    return;
+  }
+
+  queue[index].key = key;
+  queue[index].pressed = pressed;
+  queue[index].time = time;
+  KEYPAD_BARRIER();
+  head = next;
+}
+
+/**
+ * @brief Takes the oldest event from the queue.
+ *
+ * The slot is copied before the tail moves past it, so the interrupt never
+ * overwrites an event that is still being read.
+ *
+ * @param event Receives the event.
+ * @return True if there was an event, otherwise false.
+ */
+bool KeypadScanner::pop(KeyEvent& event) {
+  uint8_t index = tail;
+
+  if (index == head) {
+    return false;
+  }
+
+  KEYPAD_BARRIER();
+  event = queue[index];
+  KEYPAD_BARRIER();
+  tail = (index + 1) & (KEYPAD_QUEUE_SIZE - 1);
+  return true;
+}
+
+/**
+ * @brief Checks whether a key is down after debouncing.
+ *
+ * @param key The character of the key.
+ * @return True if the key is down, otherwise false.
+ */
+bool KeypadScanner::isPressed(char key) {
+  uint16_t keys;
+
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { keys = stableKeys; }
+
+  for (uint8_t row = 0; row < KEYPAD_ROWS; row++) {
+    for (uint8_t col = 0; col < KEYPAD_COLS; col++) {
+      if (keymap[row][col] == key) {
+        return keys & (1U << (row * KEYPAD_COLS + col));
+      }
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Scans the keypad once and queues the debounced changes.
+ *
+ * A key that reads differently from its debounced state starts counting and
+ * remembers the time; a read that agrees again resets the count, so bounces
+ * never reach the queue. The time stamped on the event is that of the first
+ * differing read, at most one scan period after the actual change.
+ */
+void KeypadScanner::scan() {
+  uint32_t now = micros();
+  uint16_t changed = readKeys() ^ stableKeys;
+
+  for (uint8_t key = 0; key < KEYPAD_KEYS; key++) {
+    uint16_t bit = 1U << key;
+
+    if (!(changed & bit)) {
+      counts[key] = 0;
+      continue;
+    }
+
+    if (counts[key] == 0) {
+      changeTimes[key] = now;
+    }
+    if (++counts[key] < KEYPAD_DEBOUNCE_SCANS) {
+      continue;
+    }
+
+    counts[key] = 0;
+    stableKeys ^= bit;
+    push(keymap[key / KEYPAD_COLS][key % KEYPAD_COLS], stableKeys & bit,
+         changeTimes[key]);
+  }
+}
+
+/**
+ * @brief Scan interrupt of the keypad.
+ *
+ * Runs with interrupts enabled, so the panel refresh can preempt the scan
+ * and its timing is not disturbed. The scan takes far less than a scan
+ * period and thus never preempts itself.
+ */
+ISR(TIMER3_COMPA_vect, ISR_NOBLOCK) { activeScanner->scan(); }
+
+#endif
@@ -0,0 +1,122 @@
+#ifndef KEYPAD_SCANNER_H
+#define KEYPAD_SCANNER_H
+
+#include <Arduino.h>
+
+#include "KeypadLayout.h"
+
+/**
+ * @brief Time between two scans of the keypad in milliseconds.
+ */
+#define KEYPAD_SCAN_PERIOD 1
+
+/**
+ * @brief Number of scans in a row a key must differ from its debounced state
+ * before the change is reported.
+ */
+#define KEYPAD_DEBOUNCE_SCANS 5
+
+/**
+ * @brief Time the row lines get to settle after a column is driven low, in
+ * microseconds.
+ */
+#define KEYPAD_SETTLE_US 2
+
+/**
+ * @brief Number of key events the queue holds, a power of two.
+ *
+ * The input task empties the queue every INPUT_PERIOD, so it only fills up
+ * if the main loop stalls for many presses and releases; further events are
+ * then dropped.
+ */
+#define KEYPAD_QUEUE_SIZE 16
+
+/**
+ * @brief Number of keys on the keypad.
+ */
+#define KEYPAD_KEYS (KEYPAD_ROWS * KEYPAD_COLS)
+
+/**
+ * @brief Scans the keypad from a timer interrupt.
+ *
+ * Every KEYPAD_SCAN_PERIOD, the Timer3 compare A interrupt drives the columns
+ * low one by one and reads the rows, which are pulled up. A key changes its
+ * debounced state once it has read differently for KEYPAD_DEBOUNCE_SCANS
+ * scans, and the change is queued as an event stamped with the time it was
+ * first read. Presses are thereby neither missed nor delayed by a slow main
+ * loop.
+ *
+ * The interrupt is the only producer and the main loop the only consumer of
+ * the queue: each side writes only its own index, which is a single byte, so
+ * the queue needs no locking.
+ */
+class KeypadScanner {
+ private:
+  KeyEvent queue[KEYPAD_QUEUE_SIZE];  ///< Events from tail to head.
+  volatile uint8_t head;  ///< Next slot to write, owned by the interrupt.
+  volatile uint8_t tail;  ///< Next slot to read, owned by the main loop.
+
+  volatile uint8_t* rowInputs[KEYPAD_ROWS];  ///< Input registers of rows.
+  uint8_t rowMasks[KEYPAD_ROWS];             ///< Port bits of the rows.
+  volatile uint8_t* colModes[KEYPAD_COLS];   ///< Mode registers of columns.
+  uint8_t colMasks[KEYPAD_COLS];             ///< Port bits of the columns.
+
+  volatile uint16_t stableKeys;  ///< Debounced state, one bit per key.
+  uint8_t counts[KEYPAD_KEYS];   ///< Scans a key has read differently.
+  uint32_t changeTimes[KEYPAD_KEYS];  ///< First differing reads in us.
+
+  /**
+   * @brief Reads which keys are down, without debouncing.
+   *
+   * @return One bit per key, set if the key is down.
+   */
+  uint16_t readKeys();
+
+  /**
+   * @brief Queues an event, or drops it if the queue is full.
+   *
+   * @param key The character of the key.
+   * @param pressed True for a press, false for a release.
+   * @param time The time of the change in microseconds.
+   */
+  void push(char key, bool pressed, uint32_t time);
+
+ public:
+  /**
+   * @brief Constructor for the KeypadScanner class.
+   */
+  KeypadScanner();
+
+  /**
+   * @brief Configures the pins and starts the scan interrupt.
+   *
+   * Keys that are down already are taken as the initial state, so they are
+   * not reported until they have been released and pressed again.
+   */
+  void begin();
+
+  /**
+   * @brief Takes the oldest event from the queue.
+   *
+   * @param event Receives the event.
+   * @return True if there was an event, otherwise false.
+   */
+  bool pop(KeyEvent& event);
+
+  /**
+   * @brief Checks whether a key is down after debouncing.
+   *
+   * @param key The character of the key.
+   * @return True if the key is down, otherwise false.
+   */
+  bool isPressed(char key);
+
+  /**
+   * @brief Scans the keypad once and queues the debounced changes.
+   *
+   * Called by the scan interrupt only.
+   */
+  void scan();
+};
+
+#endif
@@ -0,0 +1,182 @@
+#include "LatencyProbe.h"
+
+#if LATENCY_PROBE
+
+#include <avr/pgmspace.h>
+
+const char LEFT_KEY[] PROGMEM = "left";
+const char RIGHT_KEY[] PROGMEM = "right";
+const char ROTATE_KEY[] PROGMEM = "rotate";
+const char DOWN_KEY[] PROGMEM = "down";
+const char OTHER_KEY[] PROGMEM = "other";
+
+/**
+ * @brief Names of the key types, stored in program memory.
+ */
+const char* const PROBE_KEY_NAMES[NUM_PROBE_KEYS] PROGMEM = {
+    LEFT_KEY, RIGHT_KEY, ROTATE_KEY, DOWN_KEY, OTHER_KEY};
+
+uint32_t LatencyProbe::pressTimes[NUM_PROBE_KEYS];
+bool LatencyProbe::pending[NUM_PROBE_KEYS];
+uint32_t LatencyProbe::maxLatency[NUM_PROBE_KEYS];
+uint16_t LatencyProbe::samples = 0;
+uint16_t LatencyProbe::histogram[NUM_PROBE_KEYS][LATENCY_PROBE_BUCKETS];
+
+/**
+ * @brief Sets up the pulse pin.
+ */
+void LatencyProbe::begin() {
+#if LATENCY_PROBE_PULSE
+  pinMode(LATENCY_PROBE_PIN, OUTPUT);
+  digitalWrite(LATENCY_PROBE_PIN, LOW);
+#endif
+}
+
+/**
+ * @brief Starts measuring a key press.
+ *
+ * @param key The pressed key.
+ * @param time The time the press was detected in microseconds.
+ */
+void LatencyProbe::keyPressed(char key, uint32_t time) {
+  ProbeKey type;
+
+  switch (key) {
+    case '6':
+      type = PROBE_LEFT;
+      break;
+    case '4':
+      type = PROBE_RIGHT;
+      break;
+    case '5':
+      type = PROBE_ROTATE;
+      break;
+    case '2':
+      type = PROBE_DOWN;
+      break;
+    default:
+      type = PROBE_OTHER;
+  }
+
+  if (!pending[type]) {
+    pressTimes[type] = time;
+    pending[type] = true;
+  }
+
+#if LATENCY_PROBE_PULSE
+  digitalWrite(LATENCY_PROBE_PIN, HIGH);
+#endif
+}
+
+/**
+ * @brief Ends the measurement of all pending presses.
+ *
+ * Prints a report every LATENCY_PROBE_REPORT_SAMPLES measured presses.
+ */
+void LatencyProbe::framePresented() {
+  uint32_t now = micros();
+  bool measured = false;
+
+  for (uint8_t key = 0; key < NUM_PROBE_KEYS; key++) {
+    if (!pending[key]) {
+      continue;
+    }
+
+    uint32_t latency = now - pressTimes[key];
+    uint32_t bucket = latency / LATENCY_PROBE_BUCKET;
+    if (bucket >= LATENCY_PROBE_BUCKETS) {
+      bucket = LATENCY_PROBE_BUCKETS - 1;
+    }
+
+    if (histogram[key][bucket] < UINT16_MAX) {
+      histogram[key][bucket]++;
+    }
+    if (latency > maxLatency[key]) {
+      maxLatency[key] = latency;
+    }
+    pending[key] = false;
+    samples++;
+    measured = true;
+  }
+
+  if (!measured) {
+    return;
+  }
+
+#if LATENCY_PROBE_PULSE
+  digitalWrite(LATENCY_PROBE_PIN, LOW);
+#endif
+
+  if (samples >= LATENCY_PROBE_REPORT_SAMPLES) {
+    report();
+  }
+}
+
+/**
+ * @brief Finds a percentile of the latencies of a key type.
+ *
+ * @param key The key type.
+ * @param count The number of latencies of the key type.
+ * @param percent The percentile, 1 to 100.
+ * @return The upper bound of the bucket holding the percentile in us, or the
+ * lower bound for the last bucket, but never more than the longest latency.
+ */
+uint32_t LatencyProbe::percentile(uint8_t key, uint16_t count,
+                                  uint8_t percent) {
+  const uint32_t bucketWidth = LATENCY_PROBE_BUCKET;
+
+  // Rank of the percentile among the sorted latencies, rounded up
+  uint16_t rank = (static_cast<uint32_t>(count) * percent + 99) / 100;
+  uint16_t seen = 0;
+  uint32_t bound = (LATENCY_PROBE_BUCKETS - 1) * bucketWidth;
+
+  for (uint8_t bucket = 0; bucket < LATENCY_PROBE_BUCKETS - 1; bucket++) {
+    seen += histogram[key][bucket];
+    if (seen >= rank) {
+      bound = (bucket + 1) * bucketWidth;
+      break;
+    }
+  }
+
+  // The percentile lies in the bucket, so it cannot exceed the longest
+  // latency even where the bucket's bound does
+  return bound < maxLatency[key] ? bound : maxLatency[key];
+}
+
+/**
+ * @brief Prints the latencies of all key types and resets them.
+ *
+ * Prints one line per key type with the number of presses, the median, the
+ * 99th percentile and the longest latency in microseconds. The percentiles
+ * are rounded up to LATENCY_PROBE_BUCKET.
+ */
+void LatencyProbe::report() {
+  Serial.println(F("latency: presses p50 p99 max us"));
+
+  for (uint8_t key = 0; key < NUM_PROBE_KEYS; key++) {
+    uint16_t count = 0;
+    for (uint8_t bucket = 0; bucket < LATENCY_PROBE_BUCKETS; bucket++) {
+      count += histogram[key][bucket];
+    }
+
+    Serial.print(reinterpret_cast<const __FlashStringHelper*>(
+        pgm_read_word(&PROBE_KEY_NAMES[key])));
+    Serial.print(F(": "));
+    Serial.print(count);
+    if (count > 0) {
+      Serial.print(' ');
+      Serial.print(percentile(key, count, 50));
+      Serial.print(' ');
+      Serial.print(percentile(key, count, 99));
+      Serial.print(' ');
+      Serial.print(maxLatency[key]);
+    }
+    Serial.println();
+  }
+
+  memset(histogram, 0, sizeof(histogram));
+  memset(maxLatency, 0, sizeof(maxLatency));
+  samples = 0;
+}
+
+#endif
@@ -0,0 +1,137 @@
+#ifndef LATENCY_PROBE_H
+#define LATENCY_PROBE_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Enables the input-to-pixel latency probe.
+ *
+ * Set to 1 to measure the time from a key press to the end of the frame that
+ * shows its effect, and to report it over Serial. Left at 0, the probe
+ * macros expand to nothing.
+ */
+#ifndef LATENCY_PROBE
+#define LATENCY_PROBE 0
+#endif
+
+/**
+ * @brief Enables a pulse on LATENCY_PROBE_PIN for every measured press.
+ *
+ * The pin goes high when the press is detected and low when its frame has
+ * been presented, so a logic analyzer on the keypad lines and this pin can
+ * verify the reported numbers.
+ */
+#ifndef LATENCY_PROBE_PULSE
+#define LATENCY_PROBE_PULSE 0
+#endif
+
+/**
+ * @brief Spare pin for the latency pulse.
+ */
+#define LATENCY_PROBE_PIN 31
+
+/**
+ * @brief Number of measured presses after which a report is printed.
+ */
+#define LATENCY_PROBE_REPORT_SAMPLES 50
+
+/**
+ * @brief Width of a latency histogram bucket in microseconds.
+ */
+#define LATENCY_PROBE_BUCKET 1000
+
+/**
+ * @brief Number of latency histogram buckets per key type.
+ *
+ * The last bucket collects all latencies beyond the others, so percentiles
+ * that fall into it are reported as its lower bound.
+ */
+#define LATENCY_PROBE_BUCKETS 48
+
+/**
+ * @brief Key types the latency is reported for.
+ */
+enum ProbeKey {
+  PROBE_LEFT,    ///< Key 6, moves the Tetromino left.
+  PROBE_RIGHT,   ///< Key 4, moves the Tetromino right.
+  PROBE_ROTATE,  ///< Key 5, rotates the Tetromino.
+  PROBE_DOWN,    ///< Key 2, moves the Tetromino down.
+  PROBE_OTHER,   ///< All other keys.
+  NUM_PROBE_KEYS
+};
+
+#if LATENCY_PROBE
+
+/**
+ * @brief The LatencyProbe class measures the input-to-pixel latency.
+ *
+ * A press is pending from the time it was detected until the next frame has
+ * been presented, since that frame is the first to show its effect. The
+ * latencies are kept in histograms per key type, from which the median and
+ * the 99th percentile are reported.
+ */
+class LatencyProbe {
+ private:
+  static uint32_t pressTimes[NUM_PROBE_KEYS];  ///< Pending press times in us.
+  static bool pending[NUM_PROBE_KEYS];         ///< Presses awaiting a frame.
+  static uint32_t maxLatency[NUM_PROBE_KEYS];  ///< Longest latency in us.
+  static uint16_t samples;  ///< Presses measured since the last report.
+
+  /**
+   * @brief Number of latencies per key type and bucket.
+   */
+  static uint16_t histogram[NUM_PROBE_KEYS][LATENCY_PROBE_BUCKETS];
+
+  /**
+   * @brief Finds a percentile of the latencies of a key type.
+   *
+   * @param key The key type.
+   * @param count The number of latencies of the key type.
+   * @param percent The percentile, 1 to 100.
+   * @return The upper bound of the bucket holding the percentile in us,
+   * capped at the longest latency of the key type.
+   */
+  static uint32_t percentile(uint8_t key, uint16_t count, uint8_t percent);
+
+  /**
+   * @brief Prints the latencies of all key types and resets them.
+   */
+  static void report();
+
+ public:
+  /**
+   * @brief Sets up the pulse pin.
+   */
+  static void begin();
+
+  /**
+   * @brief Starts measuring a key press.
+   *
+   * A press of a key type that is still pending keeps the earlier time.
+   *
+   * @param key The pressed key.
+   * @param time The time the press was detected in microseconds.
+   */
+  static void keyPressed(char key, uint32_t time);
+
+  /**
+   * @brief Ends the measurement of all pending presses.
+   *
+   * Called when a frame has been presented.
+   */
+  static void framePresented();
+};
+
+#define LATENCY_PROBE_BEGIN() LatencyProbe::begin()
+#define LATENCY_PROBE_KEY(key, time) LatencyProbe::keyPressed(key, time)
+#define LATENCY_PROBE_FRAME() LatencyProbe::framePresented()
+
+#else
+
+#define LATENCY_PROBE_BEGIN()
+#define LATENCY_PROBE_KEY(key, time)
+#define LATENCY_PROBE_FRAME()
+
+#endif
+
+#endif
@@ -0,0 +1,123 @@
+#include "LineClearEffect.h"
+
+/**
+ * @brief Constructor for the LineClearEffect class.
+ *
+ * Starts inactive.
+ */
+LineClearEffect::LineClearEffect() : rows(0), stepTime(0), step(0) {}
+
+/**
+ * @brief Starts the animation for a line clear.
+ *
+ * The first flash is drawn by the next update, without waiting a full step.
+ *
+ * @param clearedRows Mask of the cleared rows, as reported by the board.
+ * @param currentTime The current time in milliseconds.
+ */
+void LineClearEffect::start(uint32_t clearedRows, uint32_t currentTime) {
+  rows = clearedRows;
+  stepTime = currentTime - LINE_CLEAR_STEP_TIME;
+  step = 0;
+}
+
+/**
+ * @brief Draws the rows above the lowest cleared row partly collapsed.
+ *
+ * The board already holds the collapsed stack, so a row that has not landed
+ * yet is drawn from its final board row at a position further up. Every row
+ * falls until it has dropped by the number of cleared rows below it; rows
+ * left behind by the falling ones are drawn empty.
+ *
+ * @param board The board whose rows were cleared.
+ * @param drop The number of rows the rows above have fallen so far.
+ * @return True once every row rests on the stack.
+ */
+bool LineClearEffect::drawCollapse(const Board& board, uint8_t drop) {
+  uint8_t lowestRow = Board::HEIGHT - 1;
+  while (!(rows & (1UL << lowestRow))) {
+    lowestRow--;
+  }
+
+  // Walk the rows as shown before the clear from the bottom up, counting the
+  // cleared rows below the current one
+  uint8_t below = 0;
+  int8_t y = lowestRow;
+  for (int8_t row = lowestRow; row >= 0; row--) {
+    if (rows & (1UL << row)) {
+      below++;
+      continue;
+    }
+
+    int8_t shownY = row + (below < drop ? below : drop);
+    for (; y > shownY; y--) {
+      for (uint8_t x = 0; x < Board::WIDTH; x++) {
+        Board::drawCell(x, y, BLACK);
+      }
+    }
+    for (uint8_t x = 0; x < Board::WIDTH; x++) {
+      TetrominoType type = board.getFieldType(x, row + below);
+      Board::drawCell(x, y, Tetromino::getColorIndex(type));
+    }
+    y--;
+  }
+  for (; y >= 0; y--) {
+    for (uint8_t x = 0; x < Board::WIDTH; x++) {
+      Board::drawCell(x, y, BLACK);
+    }
+  }
+
+  return drop >= below;
+}
+
+/**
+ * @brief Advances the animation if its next step is due.
+ *
+ * The flash steps fill the cleared rows in white and black by turns. Each
+ * following step lowers the rows above by one, so the stack collapses over
+ * as many steps as rows were cleared, and the last one shows the committed
+ * board state.
+ *
+ * @param board The board whose rows were cleared.
+ * @param currentTime The current time in milliseconds.
+ */
+void LineClearEffect::update(Board& board, uint32_t currentTime) {
+  uint16_t stepLength =
+      step <= LINE_CLEAR_FLASHES ? LINE_CLEAR_STEP_TIME : LINE_CLEAR_DROP_TIME;
+
+  if (rows == 0 || currentTime - stepTime < stepLength) {
+    return;
+  }
+  stepTime = currentTime;
+
+  if (step < LINE_CLEAR_FLASHES) {
+    Colors color = step % 2 == 0 ? WHITE : BLACK;
+
+    for (uint8_t y = 0; y < Board::HEIGHT; y++) {
+      if (rows & (1UL << y)) {
+        for (uint8_t x = 0; x < Board::WIDTH; x++) {
+          Board::drawCell(x, y, color);
+        }
+      }
+    }
+    step++;
+    return;
+  }
+
+  step++;
+  if (drawCollapse(board, step - LINE_CLEAR_FLASHES)) {
+    rows = 0;
+  }
+}
+
+/**
+ * @brief Stops the animation without drawing anything.
+ */
+void LineClearEffect::cancel() { rows = 0; }
+
+/**
+ * @brief Checks whether the animation is running.
+ *
+ * @return True while the animation is running, otherwise false.
+ */
+bool LineClearEffect::isActive() const { return rows != 0; }
@@ -0,0 +1,83 @@
+#ifndef LINE_CLEAR_EFFECT_H
+#define LINE_CLEAR_EFFECT_H
+
+#include "Board.h"
+
+/**
+ * @brief Timing of the line clear animation.
+ *
+ * The cleared rows flash LINE_CLEAR_FLASHES times, alternating between white
+ * and black, with LINE_CLEAR_STEP_TIME milliseconds per step. One more step
+ * later the rows above start to collapse, falling one row every
+ * LINE_CLEAR_DROP_TIME milliseconds until they rest on the stack.
+ */
+#define LINE_CLEAR_FLASHES 4
+#define LINE_CLEAR_STEP_TIME 60
+#define LINE_CLEAR_DROP_TIME 30
+
+/**
+ * @brief Animates cleared lines without blocking the game loop.
+ *
+ * The board commits a line clear at once; this effect only catches up the
+ * display. The game loop advances it once per frame, and every call does at
+ * most one step of drawing, so input polling and music continue while the
+ * animation runs.
+ */
+class LineClearEffect {
+ private:
+  uint32_t rows;      ///< Cleared rows as shown before the collapse.
+  uint32_t stepTime;  ///< Time the current step started.
+  uint8_t step;       ///< Number of steps done so far.
+
+  /**
+   * @brief Draws the rows above the lowest cleared row partly collapsed.
+   *
+   * @param board The board whose rows were cleared.
+   * @param drop The number of rows the rows above have fallen so far.
+   * @return True once every row rests on the stack.
+   */
+  bool drawCollapse(const Board& board, uint8_t drop);
+
+ public:
+  /**
+   * @brief Constructor for the LineClearEffect class.
+   *
+   * Starts inactive.
+   */
+  LineClearEffect();
+
+  /**
+   * @brief Starts the animation for a line clear.
+   *
+   * @param clearedRows Mask of the cleared rows, as reported by the board.
+   * @param currentTime The current time in milliseconds.
+   */
+  void start(uint32_t clearedRows, uint32_t currentTime);
+
+  /**
+   * @brief Advances the animation if its next step is due.
+   *
+   * Flashes the cleared rows, and after the last flash lowers the rows above
+   * them one row per step. The effect ends once they rest on the stack.
+   *
+   * @param board The board whose rows were cleared.
+   * @param currentTime The current time in milliseconds.
+   */
+  void update(Board& board, uint32_t currentTime);
+
+  /**
+   * @brief Stops the animation without drawing anything.
+   *
+   * Used when the board is redrawn in full anyway.
+   */
+  void cancel();
+
+  /**
+   * @brief Checks whether the animation is running.
+   *
+   * @return True while the animation is running, otherwise false.
+   */
+  bool isActive() const;
+};
+
+#endif
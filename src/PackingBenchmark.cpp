@@ -0,0 +1,94 @@
+#include "PackingBenchmark.h"
+
+#if PACKING_BENCHMARK
+
+#include <Arduino.h>
+
+#include "Board.h"
+#include "CellPacking.h"
+
+/**
+ * @brief Keeps the compiler from discarding the benchmarked reads.
+ */
+static volatile uint8_t benchmarkSink;
+
+/**
+ * @brief Measures a single cell packing policy and reports the results.
+ *
+ * Works on a field of the configured board size, so the timings reflect the
+ * cell accesses of the actual game.
+ *
+ * @tparam Packing The cell packing policy to measure.
+ * @param name The name of the policy, stored in program memory.
+ */
+template <typename Packing>
+static void benchmarkPacking(const __FlashStringHelper* name) {
+  typedef BasicBoard<BOARD_WIDTH, BOARD_HEIGHT, BOARD_SCALE, BOARD_OFFSET_X,
+                     BOARD_OFFSET_Y, Packing>
+      BoardType;
+
+  uint8_t field[BOARD_HEIGHT][(BOARD_WIDTH * Packing::BITS + 7) / 8];
+  memset(field, 0, sizeof(field));
+
+  uint32_t start = micros();
+  for (uint8_t pass = 0; pass < PACKING_BENCHMARK_PASSES; pass++) {
+    for (uint8_t y = 0; y < BOARD_HEIGHT; y++) {
+      for (uint8_t x = 0; x < BOARD_WIDTH; x++) {
+        Packing::set(field[y], x, (x + y + pass) % (Z_TETRO + 1));
+      }
+    }
+  }
+  uint32_t setTime = micros() - start;
+
+  uint8_t checksum = 0;
+  start = micros();
+  for (uint8_t pass = 0; pass < PACKING_BENCHMARK_PASSES; pass++) {
+    for (uint8_t y = 0; y < BOARD_HEIGHT; y++) {
+      for (uint8_t x = 0; x < BOARD_WIDTH; x++) {
+        checksum += Packing::get(field[y], x);
+      }
+    }
+  }
+  uint32_t getTime = micros() - start;
+  benchmarkSink = checksum;
+
+  // Clearing works on whole rows, as the board does when lines are removed
+  start = micros();
+  for (uint8_t pass = 0; pass < PACKING_BENCHMARK_PASSES; pass++) {
+    for (uint8_t y = 0; y < BOARD_HEIGHT; y++) {
+      memset(field[y], 0, sizeof(field[y]));
+    }
+    benchmarkSink = field[pass % BOARD_HEIGHT][0];
+  }
+  uint32_t clearTime = micros() - start;
+
+  Serial.print(name);
+  Serial.print(F(": field "));
+  Serial.print(sizeof(field));
+  Serial.print(F(" B, board "));
+  Serial.print(sizeof(BoardType));
+  Serial.print(F(" B, set "));
+  Serial.print(setTime);
+  Serial.print(F(" us, get "));
+  Serial.print(getTime);
+  Serial.print(F(" us, clear "));
+  Serial.print(clearTime);
+  Serial.println(F(" us"));
+}
+
+/**
+ * @brief Measures every cell packing policy and reports the results.
+ *
+ * Each loop touches BOARD_WIDTH x BOARD_HEIGHT cells per pass, so dividing a
+ * timing by PACKING_BENCHMARK_PASSES gives the cost of one full-field sweep.
+ */
+void runPackingBenchmark() {
+  Serial.print(F("Packing benchmark, passes: "));
+  Serial.println(PACKING_BENCHMARK_PASSES);
+
+  benchmarkPacking<ThreeBitPacking>(F("3-bit"));
+  benchmarkPacking<NibblePacking>(F("nibble"));
+  benchmarkPacking<BytePacking>(F("byte"));
+}
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef PACKING_BENCHMARK_H
+#define PACKING_BENCHMARK_H
+
+/**
+ * @brief Enables the cell packing benchmark at startup.
+ *
+ * Set to 1 to print the RAM use and the get/set/clear timings of every cell
+ * packing policy over Serial before the game starts. Left at 0, the benchmark
+ * is not compiled into the sketch.
+ */
+#ifndef PACKING_BENCHMARK
+#define PACKING_BENCHMARK 0
+#endif
+
+/**
+ * @brief Number of times every benchmark loop sweeps the whole field.
+ */
+#define PACKING_BENCHMARK_PASSES 50
+
+/**
+ * @brief Measures every cell packing policy and reports the results.
+ *
+ * For each policy, prints the size of the packed field and of the whole
+ * board, followed by the time in microseconds needed to set, get and clear
+ * every cell of the field PACKING_BENCHMARK_PASSES times.
+ */
+void runPackingBenchmark();
+
+#endif
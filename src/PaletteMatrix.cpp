@@ -0,0 +1,374 @@
+#include "Display.h"
+
+#if DISPLAY_PALETTE_DRIVER
+
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+#include "PaletteMatrix.h"
+
+/**
+ * @brief Number of row addresses of a 64-row panel.
+ *
+ * Row y and row y + 32 share an address and are shifted in together.
+ */
+#define PALETTE_MATRIX_ROW_PAIRS 32
+
+/**
+ * @brief Shifts the color bits of one pixel pair into the panel.
+ *
+ * Used by the refresh interrupt, unrolled eight times per loop iteration.
+ */
+#define PALETTE_MATRIX_SHIFT_PIXEL() \
+  PORTA = bits[*pixels++];           \
+  *clk = tick;                       \
+  *clk = tock
+
+/**
+ * @brief The panel refreshed by the Timer1 compare A interrupt.
+ */
+static PaletteMatrix* activeMatrix = nullptr;
+
+/**
+ * @brief Reduces a color to the channel bits of one bit plane.
+ *
+ * Every channel is scaled to PALETTE_MATRIX_PLANES bits first.
+ *
+ * @param color The 5-6-5 bit color.
+ * @param plane The bit plane.
+ * @return The red, green and blue bit of the plane in bits 0 to 2.
+ */
+static uint8_t planeColor(uint16_t color, uint8_t plane) {
+  const uint8_t levels = (1 << PALETTE_MATRIX_PLANES) - 1;
+
+  uint8_t red = ((color >> 11) * levels + 15) / 31;
+  uint8_t green = (((color >> 5) & 0x3F) * levels + 31) / 63;
+  uint8_t blue = ((color & 0x1F) * levels + 15) / 31;
+
+  return ((red >> plane) & 1) | ((green >> plane) & 1) << 1 |
+         ((blue >> plane) & 1) << 2;
+}
+
+/**
+ * @brief Constructor for the PaletteMatrix class.
+ *
+ * Allocates the pixel buffers and looks up the port registers of the
+ * control pins, so the interrupt can write them directly.
+ */
+PaletteMatrix::PaletteMatrix(uint8_t a, uint8_t b, uint8_t c, uint8_t d,
+                             uint8_t e, uint8_t clk, uint8_t lat, uint8_t oe,
+                             bool dbuf, uint8_t width)
+    : Adafruit_GFX(width, PALETTE_MATRIX_ROW_PAIRS * 2),
+      palette(),
+      paletteSize(0),
+      lastColor(0),
+      lastIndex(0),
+      planeBits(),
+      row(0),
+      plane(0),
+      busyTicks(0),
+      periodTicks(0) {
+  uint16_t size = PALETTE_MATRIX_ROW_PAIRS * width;
+
+  buffers[0] = static_cast<uint8_t*>(calloc(size, 1));
+  buffers[1] = dbuf ? static_cast<uint8_t*>(calloc(size, 1)) : buffers[0];
+  refreshBuffer = buffers[0];
+  drawBuffer = buffers[1];
+  swapPending = false;
+
+  const uint8_t controlPins[8] = {a, b, c, d, e, clk, lat, oe};
+  memcpy(pins, controlPins, sizeof(pins));
+
+  for (uint8_t i = 0; i < 5; i++) {
+    addressPorts[i] = portOutputRegister(digitalPinToPort(pins[i]));
+    addressMasks[i] = digitalPinToBitMask(pins[i]);
+  }
+  clkPort = portOutputRegister(digitalPinToPort(clk));
+  clkMask = digitalPinToBitMask(clk);
+  latPort = portOutputRegister(digitalPinToPort(lat));
+  latMask = digitalPinToBitMask(lat);
+  oePort = portOutputRegister(digitalPinToPort(oe));
+  oeMask = digitalPinToBitMask(oe);
+}
+
+/**
+ * @brief Sets the palette colors.
+ *
+ * Rebuilds the port value tables of all bit planes for every pair of palette
+ * indices.
+ *
+ * @param colors The 5-6-5 bit colors, stored in program memory.
+ * @param count The number of colors, at most PALETTE_MATRIX_COLORS.
+ */
+void PaletteMatrix::setPalette(const uint16_t* colors, uint8_t count) {
+  paletteSize = min(count, PALETTE_MATRIX_COLORS);
+
+  for (uint8_t i = 0; i < paletteSize; i++) {
+    palette[i] = pgm_read_word(&colors[i]);
+  }
+  lastColor = palette[0];
+  lastIndex = 0;
+
+  for (uint8_t p = 0; p < PALETTE_MATRIX_PLANES; p++) {
+    for (uint16_t pair = 0; pair < 256; pair++) {
+      // R1, G1, B1 on PA2 to PA4, R2, G2, B2 on PA5 to PA7
+      planeBits[p][pair] = planeColor(palette[pair >> 4], p) << 2 |
+                           planeColor(palette[pair & 0x0F], p) << 5;
+    }
+  }
+}
+
+/**
+ * @brief Configures the pins and starts the refresh interrupt.
+ *
+ * Timer1 runs without prescaler in CTC mode; the interrupt sets the compare
+ * value for the duration of each bit plane.
+ */
+void PaletteMatrix::begin() {
+  for (uint8_t i = 0; i < 8; i++) {
+    pinMode(pins[i], OUTPUT);
+  }
+  *oePort |= oeMask;  // Blank the panel until the first refresh
+  *latPort &= ~latMask;
+  *clkPort &= ~clkMask;
+
+  DDRA |= 0xFC;
+  PORTA &= 0x03;
+
+  activeMatrix = this;
+
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+    TCCR1A = 0;
+    TCCR1B = _BV(WGM12) | _BV(CS10);
+    OCR1A = PALETTE_MATRIX_BASE_TICKS - 1;
+    TCNT1 = 0;
+    TIMSK1 |= _BV(OCIE1A);
+  }
+}
+
+/**
+ * @brief Finds the palette index of a color.
+ *
+ * Drawing functions are called with the same color over and over, so the
+ * last lookup is cached. Colors outside the palette map to the closest
+ * palette color.
+ *
+ * @param color The 5-6-5 bit color.
+ * @return The index of the color, or of the closest palette color.
+ */
+uint8_t PaletteMatrix::findIndex(uint16_t color) {
+  if (color == lastColor) {
+    return lastIndex;
+  }
+
+  uint8_t best = 0;
+  uint16_t bestDistance = 0xFFFF;
+
+  for (uint8_t i = 0; i < paletteSize && bestDistance != 0; i++) {
+    int8_t red = (color >> 11) - (palette[i] >> 11);
+    int8_t green = ((color >> 5) & 0x3F) - ((palette[i] >> 5) & 0x3F);
+    int8_t blue = (color & 0x1F) - (palette[i] & 0x1F);
+    uint16_t distance = red * red + green * green / 4 + blue * blue;
+
+    if (distance < bestDistance) {
+      best = i;
+      bestDistance = distance;
+    }
+  }
+
+  lastColor = color;
+  lastIndex = best;
+  return best;
+}
+
+/**
+ * @brief Sets a pixel in the draw buffer.
+ *
+ * The upper half of the panel is kept in the high nibbles of the buffer, the
+ * lower half in the low nibbles.
+ */
+void PaletteMatrix::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (x < 0 || y < 0 || x >= WIDTH || y >= HEIGHT) {
+    return;
+  }
+
+  uint8_t index = findIndex(color);
+  uint8_t* pixel = &drawBuffer[(y % PALETTE_MATRIX_ROW_PAIRS) * WIDTH + x];
+
+  if (y < PALETTE_MATRIX_ROW_PAIRS) {
+    *pixel = (*pixel & 0x0F) | index << 4;
+  } else {
+    *pixel = (*pixel & 0xF0) | index;
+  }
+}
+
+void PaletteMatrix::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                  uint16_t color) {
+  fillRect(x, y, w, 1, color);
+}
+
+void PaletteMatrix::drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                  uint16_t color) {
+  fillRect(x, y, 1, h, color);
+}
+
+/**
+ * @brief Fills a rectangle in the draw buffer.
+ *
+ * Clips the rectangle once and looks up the palette index once, instead of
+ * doing both for every pixel.
+ */
+void PaletteMatrix::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                             uint16_t color) {
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (x + w > WIDTH) {
+    w = WIDTH - x;
+  }
+  if (y + h > HEIGHT) {
+    h = HEIGHT - y;
+  }
+  if (w <= 0 || h <= 0) {
+    return;
+  }
+
+  uint8_t index = findIndex(color);
+
+  for (int16_t line = y; line < y + h; line++) {
+    bool upper = line < PALETTE_MATRIX_ROW_PAIRS;
+    uint8_t keep = upper ? 0x0F : 0xF0;
+    uint8_t value = upper ? index << 4 : index;
+    uint8_t* pixel = &drawBuffer[(line % PALETTE_MATRIX_ROW_PAIRS) * WIDTH + x];
+
+    for (int16_t col = 0; col < w; col++, pixel++) {
+      *pixel = (*pixel & keep) | value;
+    }
+  }
+}
+
+void PaletteMatrix::fillScreen(uint16_t color) {
+  uint8_t index = findIndex(color);
+  memset(drawBuffer, index << 4 | index, PALETTE_MATRIX_ROW_PAIRS * WIDTH);
+}
+
+/**
+ * @brief Shows the back buffer at the end of the current refresh.
+ *
+ * The interrupt switches buffers between two full refreshes, so the panel
+ * never shows parts of two frames.
+ *
+ * @param copy Whether the new back buffer starts as a copy of the new front
+ * buffer.
+ */
+void PaletteMatrix::swapBuffers(bool copy) {
+  if (buffers[0] == buffers[1]) {
+    return;
+  }
+
+  swapPending = true;
+  while (swapPending) {
+  }
+
+  uint8_t* shown = refreshBuffer;
+  drawBuffer = shown == buffers[0] ? buffers[1] : buffers[0];
+
+  if (copy) {
+    memcpy(drawBuffer, shown, PALETTE_MATRIX_ROW_PAIRS * WIDTH);
+  }
+}
+
+/**
+ * @brief Retrieves the share of CPU time taken by the refresh interrupt.
+ *
+ * @return The duty cycle of the interrupt in per mille.
+ */
+uint16_t PaletteMatrix::getIsrDuty() {
+  uint32_t busy;
+  uint32_t period;
+
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+    busy = busyTicks;
+    period = periodTicks;
+    busyTicks = 0;
+    periodTicks = 0;
+  }
+
+  return period < 1000 ? 0 : busy / (period / 1000);
+}
+
+/**
+ * @brief Shows the next bit plane and shifts in the one after it.
+ *
+ * Latches the data shifted in by the previous call and shows it for the
+ * duration of its bit plane. While it is shown, the data of the following
+ * bit plane is shifted in. Buffers are swapped after the last row, between
+ * two full refreshes.
+ *
+ * The timer restarts at every compare match, so its count at the end of the
+ * interrupt is the time the interrupt took, including its entry latency.
+ */
+void PaletteMatrix::refresh() {
+  *oePort |= oeMask;
+  *latPort |= latMask;
+
+  for (uint8_t i = 0; i < 5; i++) {
+    if (row & (1 << i)) {
+      *addressPorts[i] |= addressMasks[i];
+    } else {
+      *addressPorts[i] &= ~addressMasks[i];
+    }
+  }
+
+  uint16_t duration = PALETTE_MATRIX_BASE_TICKS << plane;
+  OCR1A = duration - 1;
+
+  *oePort &= ~oeMask;
+  *latPort &= ~latMask;
+
+  if (++plane == PALETTE_MATRIX_PLANES) {
+    plane = 0;
+    if (++row == PALETTE_MATRIX_ROW_PAIRS) {
+      row = 0;
+      if (swapPending) {
+        refreshBuffer = refreshBuffer == buffers[0] ? buffers[1] : buffers[0];
+        swapPending = false;
+      }
+    }
+  }
+
+  const uint8_t* bits = planeBits[plane];
+  const uint8_t* pixels = refreshBuffer + row * WIDTH;
+  volatile uint8_t* clk = clkPort;
+  uint8_t tock = *clk & ~clkMask;
+  uint8_t tick = tock | clkMask;
+
+  for (uint8_t x = 0; x < WIDTH; x += 8) {
+    PALETTE_MATRIX_SHIFT_PIXEL();
+    PALETTE_MATRIX_SHIFT_PIXEL();
+    PALETTE_MATRIX_SHIFT_PIXEL();
+    PALETTE_MATRIX_SHIFT_PIXEL();
+    PALETTE_MATRIX_SHIFT_PIXEL();
+    PALETTE_MATRIX_SHIFT_PIXEL();
+    PALETTE_MATRIX_SHIFT_PIXEL();
+    PALETTE_MATRIX_SHIFT_PIXEL();
+  }
+
+  busyTicks += TCNT1;
+  periodTicks += duration;
+}
+
+/**
+ * @brief Refresh interrupt of the panel.
+ *
+ * Uses the compare A vector, so it does not collide with the overflow
+ * interrupt of RGBmatrixPanel, which is still linked with the library.
+ */
+ISR(TIMER1_COMPA_vect) { activeMatrix->refresh(); }
+
+#endif
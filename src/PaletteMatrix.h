@@ -0,0 +1,161 @@
+#ifndef PALETTE_MATRIX_H
+#define PALETTE_MATRIX_H
+
+#include <Adafruit_GFX.h>
+
+/**
+ * @brief Number of bit planes per color channel, 1 to 4.
+ *
+ * Every channel of a palette color is reduced to this many bits. Each plane
+ * costs one refresh interrupt per row, so fewer planes leave more CPU time
+ * to the game; two planes already tell all colors of the game apart.
+ */
+#define PALETTE_MATRIX_PLANES 2
+
+/**
+ * @brief Timer ticks the least significant bit plane is shown.
+ *
+ * Plane p is shown for PALETTE_MATRIX_BASE_TICKS << p ticks of the 16 MHz
+ * clock. Must exceed the run time of the refresh interrupt, which shifts a
+ * whole row within the shortest plane. Larger values lower both the refresh
+ * rate and the share of CPU time the interrupt takes.
+ */
+#define PALETTE_MATRIX_BASE_TICKS 1200
+
+/**
+ * @brief Maximum number of palette colors; pixels store a 4-bit index.
+ */
+#define PALETTE_MATRIX_COLORS 16
+
+/**
+ * @brief Lean HUB75 driver for a 64-row panel with a palette-indexed buffer.
+ *
+ * A drop-in replacement for RGBmatrixPanel on an Arduino Mega: same
+ * constructor, same pins, same drawing functions through Adafruit_GFX.
+ * Instead of storing every bit plane of every pixel, it stores a 4-bit
+ * palette index per pixel, 2 KB for a 64x64 panel. The refresh interrupt
+ * translates pairs of indices into port values through a small table per bit
+ * plane, which is rebuilt whenever the palette changes.
+ *
+ * As with RGBmatrixPanel, the color data goes to PORTA (pins 24 to 29 for
+ * R1, G1, B1, R2, G2, B2), so pins 22 and 23 are unavailable. The refresh
+ * runs on the Timer1 compare A interrupt. Rotation is not supported.
+ */
+class PaletteMatrix : public Adafruit_GFX {
+ private:
+  uint8_t* buffers[2];              ///< Pixel buffers, the second if dbuf.
+  uint8_t* drawBuffer;              ///< Buffer that drawing goes to.
+  uint8_t* volatile refreshBuffer;  ///< Buffer the interrupt shows.
+  volatile bool swapPending;        ///< Set until the interrupt swapped.
+
+  uint16_t palette[PALETTE_MATRIX_COLORS];  ///< Palette colors, 5-6-5 bits.
+  uint8_t paletteSize;                      ///< Number of palette colors.
+  uint16_t lastColor;  ///< Color looked up last, usually drawn repeatedly.
+  uint8_t lastIndex;   ///< Palette index of lastColor.
+
+  /**
+   * @brief Port values for every pair of indices, per bit plane.
+   *
+   * Indexed by a buffer byte: the upper pixel's index in the high nibble,
+   * the lower pixel's in the low nibble.
+   */
+  uint8_t planeBits[PALETTE_MATRIX_PLANES][256];
+
+  uint8_t pins[8];  ///< Pins A to E, CLK, LAT and OE, in this order.
+
+  volatile uint8_t* addressPorts[5];  ///< Output registers of A to E.
+  uint8_t addressMasks[5];            ///< Port bits of A to E.
+  volatile uint8_t* clkPort;          ///< Output register of CLK.
+  volatile uint8_t* latPort;          ///< Output register of LAT.
+  volatile uint8_t* oePort;           ///< Output register of OE.
+  uint8_t clkMask;                    ///< Port bit of CLK.
+  uint8_t latMask;                    ///< Port bit of LAT.
+  uint8_t oeMask;                     ///< Port bit of OE.
+
+  uint8_t row;    ///< Row pair whose data sits in the shift registers.
+  uint8_t plane;  ///< Bit plane whose data sits in the shift registers.
+
+  volatile uint32_t busyTicks;    ///< Ticks spent in the refresh interrupt.
+  volatile uint32_t periodTicks;  ///< Ticks elapsed during the measurement.
+
+  /**
+   * @brief Finds the palette index of a color.
+   *
+   * @param color The 5-6-5 bit color.
+   * @return The index of the color, or of the closest palette color.
+   */
+  uint8_t findIndex(uint16_t color);
+
+ public:
+  /**
+   * @brief Constructor for the PaletteMatrix class.
+   *
+   * Takes the same arguments as the RGBmatrixPanel constructor for 64-row
+   * panels and allocates the pixel buffers.
+   *
+   * @param a Row address pin A.
+   * @param b Row address pin B.
+   * @param c Row address pin C.
+   * @param d Row address pin D.
+   * @param e Row address pin E.
+   * @param clk Clock pin, on any port.
+   * @param lat Latch pin.
+   * @param oe Output enable pin.
+   * @param dbuf True to allocate a back buffer for double buffering.
+   * @param width The width of the panel in pixels.
+   */
+  PaletteMatrix(uint8_t a, uint8_t b, uint8_t c, uint8_t d, uint8_t e,
+                uint8_t clk, uint8_t lat, uint8_t oe, bool dbuf,
+                uint8_t width = 64);
+
+  /**
+   * @brief Sets the palette colors.
+   *
+   * Drawing with a color outside the palette uses the closest palette color.
+   *
+   * @param colors The 5-6-5 bit colors, stored in program memory.
+   * @param count The number of colors, at most PALETTE_MATRIX_COLORS.
+   */
+  void setPalette(const uint16_t* colors, uint8_t count);
+
+  /**
+   * @brief Configures the pins and starts the refresh interrupt.
+   */
+  void begin();
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                uint16_t color) override;
+  void fillScreen(uint16_t color) override;
+
+  /**
+   * @brief Shows the back buffer at the end of the current refresh.
+   *
+   * Waits until the refresh interrupt made the swap. Does nothing without a
+   * back buffer.
+   *
+   * @param copy Whether the new back buffer starts as a copy of the new
+   * front buffer.
+   */
+  void swapBuffers(bool copy = true);
+
+  /**
+   * @brief Retrieves the share of CPU time taken by the refresh interrupt.
+   *
+   * Covers the time since the previous call.
+   *
+   * @return The duty cycle of the interrupt in per mille.
+   */
+  uint16_t getIsrDuty();
+
+  /**
+   * @brief Shows the next bit plane and shifts in the one after it.
+   *
+   * Called by the refresh interrupt only.
+   */
+  void refresh();
+};
+
+#endif
@@ -0,0 +1,94 @@
+#include "PieceRenderer.h"
+
+#include "Display.h"
+#include "Tetromino.h"
+
+/**
+ * @brief Constructor for the PieceRenderer class.
+ *
+ * Starts without any drawn cells.
+ */
+PieceRenderer::PieceRenderer()
+    : drawnX(0), drawnY(0), drawnMask(0), drawnColor(BLACK) {}
+
+/**
+ * @brief Tests whether a shape placed on the board covers a cell.
+ *
+ * The cell is translated into the 4x4 shape grid; cells outside the grid wrap
+ * to large unsigned values and fail the range check.
+ *
+ * @param originX The board column of the shape grid.
+ * @param originY The board row of the shape grid.
+ * @param mask The cell mask of the shape.
+ * @param x The board column of the cell.
+ * @param y The board row of the cell.
+ * @return True if the shape covers the cell, otherwise false.
+ */
+bool PieceRenderer::covers(int8_t originX, int8_t originY, uint16_t mask,
+                           int8_t x, int8_t y) {
+  uint8_t col = x - originX;
+  uint8_t row = y - originY;
+
+  return col < 4 && row < 4 && (mask & (1 << (row * 4 + col)));
+}
+
+/**
+ * @brief Brings the display up to date with the Tetromino.
+ *
+ * Computes the cells covered before but not now and erases them, then the
+ * cells covered now but not before and draws them. When the color changed,
+ * e.g. because a new Tetromino spawned, every covered cell is redrawn.
+ *
+ * @param tetromino The Tetromino to render.
+ */
+void PieceRenderer::flush(const Tetromino& tetromino) {
+  int8_t x = Board::toColumn(tetromino.getOffsetX());
+  int8_t y = Board::toRow(tetromino.getOffsetY());
+  uint16_t mask =
+      Tetromino::getShape(tetromino.getType(), tetromino.getRotation()).mask;
+  Colors color = Tetromino::getColorIndex(tetromino.getType());
+
+  if (x == drawnX && y == drawnY && mask == drawnMask && color == drawnColor) {
+    return;
+  }
+
+  // Old minus new: cells the Tetromino left
+  uint16_t cells = drawnMask;
+  for (uint8_t cell = 0; cells != 0; cell++, cells >>= 1) {
+    if (cells & 1) {
+      int8_t cellX = drawnX + cell % 4;
+      int8_t cellY = drawnY + cell / 4;
+
+      if (!covers(x, y, mask, cellX, cellY)) {
+        Board::drawCell(cellX, cellY, BLACK);
+      }
+    }
+  }
+
+  // New minus old: cells the Tetromino entered
+  bool repaint = color != drawnColor;
+  cells = mask;
+  for (uint8_t cell = 0; cells != 0; cell++, cells >>= 1) {
+    if (cells & 1) {
+      int8_t cellX = x + cell % 4;
+      int8_t cellY = y + cell / 4;
+
+      if (repaint || !covers(drawnX, drawnY, drawnMask, cellX, cellY)) {
+        Board::drawCell(cellX, cellY, color);
+      }
+    }
+  }
+
+  drawnX = x;
+  drawnY = y;
+  drawnMask = mask;
+  drawnColor = color;
+}
+
+/**
+ * @brief Forgets the drawn cells without erasing them.
+ *
+ * The next flush finds no previously drawn cells and draws the Tetromino in
+ * full.
+ */
+void PieceRenderer::reset() { drawnMask = 0; }
@@ -0,0 +1,63 @@
+#ifndef PIECE_RENDERER_H
+#define PIECE_RENDERER_H
+
+#include "Board.h"
+
+/**
+ * @brief Keeps a falling Tetromino on the display in sync with its state.
+ *
+ * The renderer remembers the cells it drew last. Each frame, flush compares
+ * them with the cells the Tetromino occupies now. Only cells the Tetromino
+ * left are erased and only cells it entered are drawn, so cells covered
+ * before and after a move are never touched and a blocked move draws
+ * nothing at all.
+ */
+class PieceRenderer {
+ private:
+  int8_t drawnX;        ///< Board column of the drawn shape grid.
+  int8_t drawnY;        ///< Board row of the drawn shape grid.
+  uint16_t drawnMask;   ///< Cells drawn last, 0 when nothing is drawn.
+  Colors drawnColor;    ///< Palette color the cells were drawn in.
+
+ public:
+  /**
+   * @brief Tests whether a shape placed on the board covers a cell.
+   *
+   * @param originX The board column of the shape grid.
+   * @param originY The board row of the shape grid.
+   * @param mask The cell mask of the shape.
+   * @param x The board column of the cell.
+   * @param y The board row of the cell.
+   * @return True if the shape covers the cell, otherwise false.
+   */
+  static bool covers(int8_t originX, int8_t originY, uint16_t mask, int8_t x,
+                     int8_t y);
+
+  /**
+   * @brief Constructor for the PieceRenderer class.
+   *
+   * Starts without any drawn cells.
+   */
+  PieceRenderer();
+
+  /**
+   * @brief Brings the display up to date with the Tetromino.
+   *
+   * Erases the cells the Tetromino no longer covers and draws the cells it
+   * newly covers. Meant to be called once per frame after all moves.
+   *
+   * @param tetromino The Tetromino to render.
+   */
+  void flush(const Tetromino& tetromino);
+
+  /**
+   * @brief Forgets the drawn cells without erasing them.
+   *
+   * Called when the cells on the display no longer belong to the Tetromino,
+   * e.g. after it was placed on the board or the screen was redrawn. The next
+   * flush draws the Tetromino in full.
+   */
+  void reset();
+};
+
+#endif
@@ -0,0 +1,112 @@
+#include "Profiler.h"
+
+#if PROFILER_ENABLED
+
+#include <avr/pgmspace.h>
+
+const char INPUT_PHASE[] PROGMEM = "input";
+const char GRAVITY_PHASE[] PROGMEM = "gravity";
+const char COLLISION_PHASE[] PROGMEM = "collision";
+const char PLACEMENT_PHASE[] PROGMEM = "placement";
+const char LINE_CLEAR_PHASE[] PROGMEM = "line clear";
+const char HUD_PHASE[] PROGMEM = "hud";
+const char AUDIO_PHASE[] PROGMEM = "audio";
+const char PLAYER_PHASE[] PROGMEM = "player";
+
+/**
+ * @brief Names of the phases, stored in program memory.
+ */
+const char* const PHASE_NAMES[NUM_PROFILE_PHASES] PROGMEM = {
+    INPUT_PHASE,      GRAVITY_PHASE, COLLISION_PHASE, PLACEMENT_PHASE,
+    LINE_CLEAR_PHASE, HUD_PHASE,     AUDIO_PHASE,     PLAYER_PHASE};
+
+PhaseStats Profiler::stats[NUM_PROFILE_PHASES];
+
+#ifdef __AVR__
+extern char* __brkval;
+extern char __heap_start;
+
+/**
+ * @brief Determines the free RAM between the heap and the stack.
+ *
+ * @return The number of free bytes.
+ */
+static int freeMemory() {
+  char top;
+  return &top - (__brkval ? __brkval : &__heap_start);
+}
+#endif
+
+/**
+ * @brief Records a run of a phase.
+ *
+ * Counts the run in the histogram bucket of its duration; a bucket stops
+ * counting when it is full.
+ *
+ * @param phase The phase that ran.
+ * @param duration The duration of the run in microseconds.
+ */
+void Profiler::record(ProfilePhase phase, uint32_t duration) {
+  PhaseStats& phaseStats = stats[phase];
+
+  if (phaseStats.count == 0 || duration < phaseStats.min) {
+    phaseStats.min = duration;
+  }
+  if (duration > phaseStats.max) {
+    phaseStats.max = duration;
+  }
+  phaseStats.count++;
+  phaseStats.total += duration;
+
+  uint8_t bucket = 0;
+  for (uint32_t bound = PROFILER_FIRST_BUCKET;
+       duration >= bound && bucket < PROFILER_BUCKETS - 1; bound <<= 1) {
+    bucket++;
+  }
+  if (phaseStats.histogram[bucket] < UINT16_MAX) {
+    phaseStats.histogram[bucket]++;
+  }
+}
+
+/**
+ * @brief Prints the statistics of all phases over Serial and resets them.
+ *
+ * Prints one line per phase with the number of runs, the shortest, average
+ * and longest run in microseconds, and the histogram buckets from the
+ * shortest durations to the longest, followed by the free RAM.
+ */
+void Profiler::dump() {
+  Serial.print(F("phase: runs min avg max us | histogram from <"));
+  Serial.print(PROFILER_FIRST_BUCKET);
+  Serial.println(F(" us, doubling"));
+
+  for (uint8_t phase = 0; phase < NUM_PROFILE_PHASES; phase++) {
+    const PhaseStats& phaseStats = stats[phase];
+
+    Serial.print(reinterpret_cast<const __FlashStringHelper*>(
+        pgm_read_word(&PHASE_NAMES[phase])));
+    Serial.print(F(": "));
+    Serial.print(phaseStats.count);
+    Serial.print(' ');
+    Serial.print(phaseStats.min);
+    Serial.print(' ');
+    Serial.print(phaseStats.count ? phaseStats.total / phaseStats.count : 0);
+    Serial.print(' ');
+    Serial.print(phaseStats.max);
+    Serial.print(F(" |"));
+    for (uint8_t bucket = 0; bucket < PROFILER_BUCKETS; bucket++) {
+      Serial.print(' ');
+      Serial.print(phaseStats.histogram[bucket]);
+    }
+    Serial.println();
+  }
+
+#ifdef __AVR__
+  Serial.print(F("free ram: "));
+  Serial.println(freeMemory());
+#endif
+
+  memset(stats, 0, sizeof(stats));
+}
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Enables the per-phase profiler.
+ *
+ * Set to 1 to time the phases of the game loop and dump the results over
+ * Serial when PROFILER_DUMP_KEY is pressed. Left at 0, the profiling macros
+ * expand to nothing and the profiler is not compiled into the sketch.
+ */
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 0
+#endif
+
+/**
+ * @brief Key that dumps and resets the profiler results.
+ */
+#define PROFILER_DUMP_KEY 'D'
+
+/**
+ * @brief Number of histogram buckets per phase.
+ *
+ * Bucket 0 counts durations below PROFILER_FIRST_BUCKET microseconds, every
+ * following bucket twice the range of the previous one, and the last bucket
+ * everything above.
+ */
+#define PROFILER_BUCKETS 10
+
+/**
+ * @brief Upper bound of the first histogram bucket in microseconds.
+ *
+ * micros() counts in steps of 4 microseconds on a 16 MHz board, so finer
+ * buckets would not tell durations apart.
+ */
+#define PROFILER_FIRST_BUCKET 8
+
+/**
+ * @brief Phases of the game loop that are timed.
+ *
+ * Phases may nest, such as collision checks within gravity, and are timed
+ * inclusively.
+ */
+enum ProfilePhase {
+  PROFILE_INPUT,       ///< Polling the keypad and handling the key.
+  PROFILE_GRAVITY,     ///< Letting the current Tetromino fall one step.
+  PROFILE_COLLISION,   ///< Checking a Tetromino position for collisions.
+  PROFILE_PLACEMENT,   ///< Placing a landed Tetromino on the board.
+  PROFILE_LINE_CLEAR,  ///< Clearing full lines.
+  PROFILE_HUD,         ///< Updating score, lines, level and next Tetromino.
+  PROFILE_AUDIO,       ///< Stepping the sound effects.
+  PROFILE_PLAYER,      ///< Polling the MP3 player.
+  NUM_PROFILE_PHASES
+};
+
+#if PROFILER_ENABLED
+
+/**
+ * @brief Timing statistics of a phase.
+ */
+struct PhaseStats {
+  uint32_t count;                       ///< Number of timed runs.
+  uint32_t total;                       ///< Sum of all runs in us.
+  uint32_t min;                         ///< Shortest run in us.
+  uint32_t max;                         ///< Longest run in us.
+  uint16_t histogram[PROFILER_BUCKETS];  ///< Runs per duration bucket.
+};
+
+/**
+ * @brief The Profiler class collects the timings of the game loop phases.
+ */
+class Profiler {
+ private:
+  static PhaseStats stats[NUM_PROFILE_PHASES];  ///< Statistics per phase.
+
+ public:
+  /**
+   * @brief Records a run of a phase.
+   *
+   * @param phase The phase that ran.
+   * @param duration The duration of the run in microseconds.
+   */
+  static void record(ProfilePhase phase, uint32_t duration);
+
+  /**
+   * @brief Prints the statistics of all phases over Serial and resets them.
+   */
+  static void dump();
+};
+
+/**
+ * @brief Times the enclosing scope as a run of a phase.
+ */
+class ProfileScope {
+ private:
+  ProfilePhase phase;  ///< The phase being timed.
+  uint32_t start;      ///< Start of the run in us.
+
+ public:
+  explicit ProfileScope(ProfilePhase phase) : phase(phase), start(micros()) {}
+  ~ProfileScope() { Profiler::record(phase, micros() - start); }
+};
+
+#define PROFILE_SCOPE(phase) ProfileScope profileScope(phase)
+#define PROFILER_DUMP() Profiler::dump()
+
+#else
+
+#define PROFILE_SCOPE(phase)
+#define PROFILER_DUMP()
+
+#endif
+
+#endif
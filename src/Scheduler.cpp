@@ -0,0 +1,117 @@
+#include "Scheduler.h"
+
+/**
+ * @brief Constructor for the Scheduler class.
+ */
+Scheduler::Scheduler() : tasks(), taskCount(0), lastReport(0) {}
+
+/**
+ * @brief Adds a task whose first slot starts now.
+ *
+ * @param name The name of the task for the report, stored in program memory.
+ * @param function The work of the task.
+ * @param period The time between two slots in milliseconds.
+ * @param catchUp Whether slots missed while the task fell behind are run.
+ * @return True if the task was added, false if the scheduler is full.
+ */
+bool Scheduler::addTask(const __FlashStringHelper* name, void (*function)(),
+                        uint16_t period, bool catchUp) {
+  if (taskCount == SCHEDULER_MAX_TASKS) {
+    return false;
+  }
+
+  Task& task = tasks[taskCount++];
+  task.name = name;
+  task.function = function;
+  task.period = period * 1000UL;
+  task.nextRun = micros();
+  task.catchUp = catchUp;
+  task.stats = TaskStats();
+  return true;
+}
+
+/**
+ * @brief Runs every task whose slot has come, in order of priority.
+ *
+ * A task runs once per due slot, up to SCHEDULER_MAX_CATCH_UP slots if it
+ * catches up and once otherwise. Slots still due after that are skipped, and
+ * the task continues on its grid with the next slot in the future.
+ */
+void Scheduler::run() {
+  for (uint8_t i = 0; i < taskCount; i++) {
+    Task& task = tasks[i];
+    uint8_t maxRuns = task.catchUp ? SCHEDULER_MAX_CATCH_UP : 1;
+
+    for (uint8_t runs = 0; static_cast<int32_t>(micros() - task.nextRun) >= 0;
+         runs++) {
+      if (runs == maxRuns) {
+        uint16_t slots = (micros() - task.nextRun) / task.period + 1;
+        task.stats.skipped += slots;
+        task.nextRun += slots * task.period;
+        break;
+      }
+      runTask(task);
+    }
+  }
+
+#if SCHEDULER_REPORT
+  if (millis() - lastReport >= SCHEDULER_REPORT_INTERVAL) {
+    report();
+    lastReport = millis();
+  }
+#endif
+}
+
+/**
+ * @brief Runs a task for its current slot and records its timing.
+ *
+ * A run that starts a full period or more after its slot counts as an
+ * overrun: the task, or a task of higher priority, took longer than the
+ * time available.
+ *
+ * @param task The task to run.
+ */
+void Scheduler::runTask(Task& task) {
+  uint32_t start = micros();
+  uint32_t lateness = start - task.nextRun;
+
+  task.function();
+
+  uint32_t runTime = micros() - start;
+  TaskStats& stats = task.stats;
+
+  stats.runs++;
+  if (lateness >= task.period) {
+    stats.overruns++;
+  }
+  if (lateness > stats.maxLateness) {
+    stats.maxLateness = lateness;
+  }
+  if (runTime > stats.maxRunTime) {
+    stats.maxRunTime = runTime;
+  }
+  task.nextRun += task.period;
+}
+
+/**
+ * @brief Prints the statistics of all tasks and resets them.
+ */
+void Scheduler::report() {
+  for (uint8_t i = 0; i < taskCount; i++) {
+    const TaskStats& stats = tasks[i].stats;
+
+    Serial.print(tasks[i].name);
+    Serial.print(F(": runs "));
+    Serial.print(stats.runs);
+    Serial.print(F(" overruns "));
+    Serial.print(stats.overruns);
+    Serial.print(F(" skipped "));
+    Serial.print(stats.skipped);
+    Serial.print(F(" max late us "));
+    Serial.print(stats.maxLateness);
+    Serial.print(F(" max run us "));
+    Serial.println(stats.maxRunTime);
+
+    tasks[i].stats = TaskStats();
+  }
+}
@@ -0,0 +1,108 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Maximum number of tasks a scheduler runs.
+ */
+#define SCHEDULER_MAX_TASKS 6
+
+/**
+ * @brief Missed slots a catching-up task runs in one pass at most.
+ *
+ * Bounds the work after a long stall, such as a screen being redrawn, so the
+ * scheduler does not spiral further behind. The remaining slots are skipped.
+ */
+#define SCHEDULER_MAX_CATCH_UP 4
+
+/**
+ * @brief Enables a periodic task statistics report over Serial.
+ */
+#ifndef SCHEDULER_REPORT
+#define SCHEDULER_REPORT 0
+#endif
+
+/**
+ * @brief Time covered by a task statistics report in milliseconds.
+ */
+#define SCHEDULER_REPORT_INTERVAL 1000
+
+/**
+ * @brief Timing statistics of a task since the last report.
+ */
+struct TaskStats {
+  uint16_t runs;         ///< Number of runs.
+  uint16_t overruns;     ///< Runs that started a period or more too late.
+  uint16_t skipped;      ///< Slots dropped because the task fell behind.
+  uint32_t maxLateness;  ///< Longest delay of a run after its slot in us.
+  uint32_t maxRunTime;   ///< Longest run in us.
+};
+
+/**
+ * @brief Cooperative scheduler running tasks on fixed time grids.
+ *
+ * Every task has its own period. Its slots lie on a fixed grid from the time
+ * it was added, so a late run does not shift the following ones. Tasks run
+ * in the order they were added, which is their priority. A task that falls
+ * behind either runs its missed slots, for logic that counts time in ticks,
+ * or only the latest one.
+ */
+class Scheduler {
+ private:
+  /**
+   * @brief A task and its schedule.
+   */
+  struct Task {
+    const __FlashStringHelper* name;  ///< Name used in the report.
+    void (*function)();               ///< Work of the task.
+    uint32_t period;                  ///< Time between two slots in us.
+    uint32_t nextRun;                 ///< Start of the next slot in us.
+    bool catchUp;                     ///< Whether missed slots are run.
+    TaskStats stats;                  ///< Statistics since the last report.
+  };
+
+  Task tasks[SCHEDULER_MAX_TASKS];  ///< Tasks in order of priority.
+  uint8_t taskCount;                ///< Number of tasks added.
+  uint32_t lastReport;              ///< Time of the last report in ms.
+
+  /**
+   * @brief Runs a task for its current slot and records its timing.
+   *
+   * @param task The task to run.
+   */
+  void runTask(Task& task);
+
+  /**
+   * @brief Prints the statistics of all tasks and resets them.
+   */
+  void report();
+
+ public:
+  /**
+   * @brief Constructor for the Scheduler class.
+   */
+  Scheduler();
+
+  /**
+   * @brief Adds a task whose first slot starts now.
+   *
+   * @param name The name of the task for the report, stored in program
+   * memory.
+   * @param function The work of the task.
+   * @param period The time between two slots in milliseconds.
+   * @param catchUp Whether slots missed while the task fell behind are run.
+   * @return True if the task was added, false if the scheduler is full.
+   */
+  bool addTask(const __FlashStringHelper* name, void (*function)(),
+               uint16_t period, bool catchUp = false);
+
+  /**
+   * @brief Runs every task whose slot has come, in order of priority.
+   *
+   * Called on every iteration of the main loop.
+   */
+  void run();
+};
+
+#endif
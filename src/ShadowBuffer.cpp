@@ -0,0 +1,150 @@
+#include "ShadowBuffer.h"
+
+#include "Board.h"
+
+/**
+ * @brief Sets the color a cell should show.
+ *
+ * Marks the row as dirty when the new color differs from the color on the
+ * panel.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @param color The palette color of the cell.
+ */
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY>
+void BasicShadowBuffer<Width, Height, Scale, OffsetX, OffsetY>::setCell(
+    uint8_t x, uint8_t y, Colors color) {
+  uint8_t shown = cells[y][x] >> 4;
+
+  cells[y][x] = (shown << 4) | color;
+
+  if (shown != color) {
+    dirtyRows |= 1UL << y;
+  }
+}
+
+/**
+ * @brief Retrieves the color a cell should show.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return The palette color of the cell.
+ */
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY>
+Colors BasicShadowBuffer<Width, Height, Scale, OffsetX, OffsetY>::getCell(
+    uint8_t x, uint8_t y) const {
+  return static_cast<Colors>(cells[y][x] & 0x0F);
+}
+
+/**
+ * @brief Pushes every changed cell to the panel.
+ *
+ * Visits only the dirty rows. Within a row, neighboring changed cells of the
+ * same target color are merged into a span and drawn with a single fillRect
+ * call of Scale pixels height, instead of one call per cell.
+ *
+ * @return The number of pixels written.
+ */
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY>
+uint16_t BasicShadowBuffer<Width, Height, Scale, OffsetX, OffsetY>::flush() {
+  uint16_t written = 0;
+
+  for (uint8_t y = 0; dirtyRows != 0; y++, dirtyRows >>= 1) {
+    if (!(dirtyRows & 1)) {
+      continue;
+    }
+
+    uint8_t x = 0;
+    while (x < Width) {
+      uint8_t target = cells[y][x] & 0x0F;
+      uint8_t settled = (target << 4) | target;
+
+      if (cells[y][x] == settled) {
+        x++;
+        continue;
+      }
+
+      // Extend the span over the following changed cells of the same color
+      uint8_t spanStart = x;
+      do {
+        cells[y][x++] = settled;
+      } while (x < Width && (cells[y][x] & 0x0F) == target &&
+               cells[y][x] != settled);
+
+      uint8_t spanLength = x - spanStart;
+      matrix.fillRect(spanStart * Scale + OffsetX, y * Scale + OffsetY,
+                      spanLength * Scale, Scale,
+                      Display::getColor(static_cast<Colors>(target)));
+
+      written += spanLength * Scale * Scale;
+      changedCells += spanLength;
+      drawCalls++;
+    }
+  }
+
+  pixelWrites += written;
+  return written;
+}
+
+/**
+ * @brief Records that the panel region was overwritten behind the buffer.
+ *
+ * @param shown The color the whole region shows now.
+ */
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY>
+void BasicShadowBuffer<Width, Height, Scale, OffsetX, OffsetY>::invalidate(
+    Colors shown) {
+  for (uint8_t y = 0; y < Height; y++) {
+    for (uint8_t x = 0; x < Width; x++) {
+      cells[y][x] = (shown << 4) | (cells[y][x] & 0x0F);
+    }
+  }
+  dirtyRows = 0xFFFFFFFFUL >> (32 - Height);
+}
+
+/**
+ * @brief Retrieves the number of pixels pushed to the panel.
+ *
+ * @return The pixels written by all flushes since startup.
+ */
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY>
+uint32_t BasicShadowBuffer<Width, Height, Scale, OffsetX, OffsetY>::
+    getPixelWrites() const {
+  return pixelWrites;
+}
+
+/**
+ * @brief Retrieves the number of cells pushed to the panel.
+ *
+ * @return The changed cells drawn by all flushes since startup.
+ */
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY>
+uint32_t BasicShadowBuffer<Width, Height, Scale, OffsetX, OffsetY>::
+    getChangedCells() const {
+  return changedCells;
+}
+
+/**
+ * @brief Retrieves the number of draw calls issued to the panel.
+ *
+ * @return The fillRect calls made by all flushes since startup.
+ */
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY>
+uint32_t BasicShadowBuffer<Width, Height, Scale, OffsetX, OffsetY>::
+    getDrawCalls() const {
+  return drawCalls;
+}
+
+/**
+ * @brief Instantiation of the shadow buffer for the configured board.
+ */
+template class BasicShadowBuffer<BOARD_WIDTH, BOARD_HEIGHT, BOARD_SCALE,
+                                 BOARD_OFFSET_X, BOARD_OFFSET_Y>;
@@ -0,0 +1,109 @@
+#ifndef SHADOW_BUFFER_H
+#define SHADOW_BUFFER_H
+
+#include "Display.h"
+
+/**
+ * @brief Off-screen copy of a cell-aligned region of the display.
+ *
+ * Rendering writes palette colors into the buffer instead of the panel. Each
+ * cell remembers both the color it should show and the color the panel shows
+ * right now, so flush can push exactly the cells that differ, once per frame.
+ * Drawing a cell several times within a frame, or back to its old color,
+ * costs no panel writes at all.
+ *
+ * The buffer has no constructor and relies on zero-initialized static
+ * storage, so boards constructed during static initialization may already
+ * write into it. Call invalidate once the panel content is known.
+ *
+ * @tparam Width The number of cells per row.
+ * @tparam Height The number of rows, at most 32.
+ * @tparam Scale The edge length of a cell in pixels.
+ * @tparam OffsetX The x-coordinate of the region's left edge on the display.
+ * @tparam OffsetY The y-coordinate of the region's top edge on the display.
+ */
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY>
+class BasicShadowBuffer {
+  static_assert(Height <= 32, "dirtyRows holds one bit per row");
+
+ private:
+  /**
+   * @brief Palette colors of every cell.
+   *
+   * The low nibble holds the color the cell should show, the high nibble the
+   * color the panel currently shows.
+   */
+  uint8_t cells[Height][Width];
+
+  uint32_t dirtyRows;     ///< Bit y is set when row y may hold changed cells.
+  uint32_t pixelWrites;   ///< Pixels pushed to the panel since startup.
+  uint32_t changedCells;  ///< Cells pushed to the panel since startup.
+  uint32_t drawCalls;     ///< Panel draw calls issued since startup.
+
+ public:
+  /**
+   * @brief Sets the color a cell should show.
+   *
+   * Only updates the buffer; the panel is written by the next flush.
+   *
+   * @param x The x-coordinate of the cell.
+   * @param y The y-coordinate of the cell.
+   * @param color The palette color of the cell.
+   */
+  void setCell(uint8_t x, uint8_t y, Colors color);
+
+  /**
+   * @brief Retrieves the color a cell should show.
+   *
+   * @param x The x-coordinate of the cell.
+   * @param y The y-coordinate of the cell.
+   * @return The palette color of the cell.
+   */
+  Colors getCell(uint8_t x, uint8_t y) const;
+
+  /**
+   * @brief Pushes every changed cell to the panel.
+   *
+   * Runs of changed cells with the same color in a row are drawn as one span.
+   *
+   * @return The number of pixels written.
+   */
+  uint16_t flush();
+
+  /**
+   * @brief Records that the panel region was overwritten behind the buffer.
+   *
+   * Called after full-screen drawing, e.g. clearing the screen. The next
+   * flush then redraws every cell that differs from the given color.
+   *
+   * @param shown The color the whole region shows now.
+   */
+  void invalidate(Colors shown);
+
+  /**
+   * @brief Retrieves the number of pixels pushed to the panel.
+   *
+   * @return The pixels written by all flushes since startup.
+   */
+  uint32_t getPixelWrites() const;
+
+  /**
+   * @brief Retrieves the number of cells pushed to the panel.
+   *
+   * Equals the number of draw calls a renderer drawing cell by cell would
+   * have issued. Compare with getDrawCalls to see the savings of the spans.
+   *
+   * @return The changed cells drawn by all flushes since startup.
+   */
+  uint32_t getChangedCells() const;
+
+  /**
+   * @brief Retrieves the number of draw calls issued to the panel.
+   *
+   * @return The fillRect calls made by all flushes since startup.
+   */
+  uint32_t getDrawCalls() const;
+};
+
+#endif
@@ -4,40 +4,104 @@
 #include "Display.h"
 
 /**
- * @brief Bit patterns defining Tetromino shapes in four rotations.
+ * @brief Tests a pixel of an 8x8 Tetromino bit pattern.
  *
- * Each entry in the array corresponds to a Tetromino type and its rotations.
- * The patterns are stored in program memory (PROGMEM) to save RAM.
+ * The pattern is written row by row with the most significant bit at the top
+ * left, so the binary literal reads like the picture it describes.
  */
-const uint64_t TETROMINOES[8][4] PROGMEM = {
-    {0b0000000000000000000000000000000011111111111111110000000000000000ULL,
-     0b0011000000110000001100000011000000110000001100000011000000110000ULL,
-     0b0000000000000000000000000000000011111111111111110000000000000000ULL,
-     0b0011000000110000001100000011000000110000001100000011000000110000ULL},  // I-TETRO
-    {0b0000000000000000000000000000000000111100001111000011110000111100ULL,
-     0b0000000000000000000000000000000000111100001111000011110000111100ULL,
-     0b0000000000000000000000000000000000111100001111000011110000111100ULL,
-     0b0000000000000000000000000000000000111100001111000011110000111100ULL},  // O-TETRO
-    {0b0000000000000000000000000000000011111100111111000011000000110000ULL,
-     0b0000000000000000001100000011000000111100001111000011000000110000ULL,
-     0b0000000000000000001100000011000011111100111111000000000000000000ULL,
-     0b0000000000000000001100000011000011110000111100000011000000110000ULL},  // T-TETRO
-    {0b0000000000000000000000000000000011000000110000001111110011111100ULL,
-     0b0000000000000000000011000000110000001100000011000011110000111100ULL,
-     0b0000000000000000000000000000000011111100111111000000110000001100ULL,
-     0b0000000000000000001111000011110000110000001100000011000000110000ULL},  // J-TETRO
-    {0b0000000000000000000000000000000000000011000000110011111100111111ULL,
-     0b0000000000000000001111000011110000001100000011000000110000001100ULL,
-     0b0000000000000000000000000000000000111111001111110011000000110000ULL,
-     0b0000000000000000001100000011000000110000001100000011110000111100ULL},  // L-TETRO
-    {0b0000000000000000000000000000000000111100001111001111000011110000ULL,
-     0b0000000000000000110000001100000011110000111100000011000000110000ULL,
-     0b0000000000000000000000000000000000111100001111001111000011110000ULL,
-     0b0000000000000000110000001100000011110000111100000011000000110000ULL},  // S-TETRO
-    {0b0000000000000000000000000000000000111100001111000000111100001111ULL,
-     0b0000000000000000000011000000110000111100001111000011000000110000ULL,
-     0b0000000000000000000000000000000000111100001111000000111100001111ULL,
-     0b0000000000000000000011000000110000111100001111000011000000110000ULL}  // Z-TETRO
+constexpr bool patternPixel(uint64_t pattern, uint8_t row, uint8_t col) {
+  return (pattern >> (63 - row * 8 - col)) & 1;
+}
+
+/**
+ * @brief Reduces an 8x8 pixel pattern to a 4x4 cell mask at compile time.
+ *
+ * Every cell covers a 2x2 pixel block, so the top-left pixel of each block
+ * decides whether the cell is occupied.
+ */
+constexpr uint16_t patternCells(uint64_t pattern, uint8_t cell = 0) {
+  return cell == 16 ? 0
+                    : (patternPixel(pattern, (cell / 4) * 2, (cell % 4) * 2)
+                           ? 1U << cell
+                           : 0) |
+                          patternCells(pattern, cell + 1);
+}
+
+/**
+ * @brief Returns the first occupied column of a cell mask.
+ */
+constexpr uint8_t firstColumn(uint16_t mask, uint8_t col = 0) {
+  return col == 3 || (mask & (0x1111 << col)) ? col
+                                              : firstColumn(mask, col + 1);
+}
+
+/**
+ * @brief Returns the last occupied column of a cell mask.
+ */
+constexpr uint8_t lastColumn(uint16_t mask, uint8_t col = 3) {
+  return col == 0 || (mask & (0x1111 << col)) ? col : lastColumn(mask, col - 1);
+}
+
+/**
+ * @brief Returns the first occupied row of a cell mask.
+ */
+constexpr uint8_t firstRow(uint16_t mask, uint8_t row = 0) {
+  return row == 3 || (mask & (0x000F << (row * 4))) ? row
+                                                    : firstRow(mask, row + 1);
+}
+
+/**
+ * @brief Returns the last occupied row of a cell mask.
+ */
+constexpr uint8_t lastRow(uint16_t mask, uint8_t row = 3) {
+  return row == 0 || (mask & (0x000F << (row * 4))) ? row
+                                                    : lastRow(mask, row - 1);
+}
+
+/**
+ * @brief Builds a TetrominoShape with its bounding box from a pixel pattern.
+ */
+#define TETROMINO_SHAPE(pattern)                                       \
+  {patternCells(pattern), firstColumn(patternCells(pattern)),          \
+   lastColumn(patternCells(pattern)), firstRow(patternCells(pattern)), \
+   lastRow(patternCells(pattern))}
+
+/**
+ * @brief Shapes of every Tetromino in four rotations.
+ *
+ * The shapes are drawn as 8x8 pixel patterns for readability and reduced to
+ * 4x4 cell masks with precomputed bounding boxes at compile time. The result
+ * is stored in program memory (PROGMEM) to save RAM.
+ */
+const TetrominoShape TETROMINOES[7][4] PROGMEM = {
+    {TETROMINO_SHAPE(0b0000000000000000000000000000000011111111111111110000000000000000ULL),
+     TETROMINO_SHAPE(0b0011000000110000001100000011000000110000001100000011000000110000ULL),
+     TETROMINO_SHAPE(0b0000000000000000000000000000000011111111111111110000000000000000ULL),
+     TETROMINO_SHAPE(0b0011000000110000001100000011000000110000001100000011000000110000ULL)},  // I-TETRO
+    {TETROMINO_SHAPE(0b0000000000000000000000000000000000111100001111000011110000111100ULL),
+     TETROMINO_SHAPE(0b0000000000000000000000000000000000111100001111000011110000111100ULL),
+     TETROMINO_SHAPE(0b0000000000000000000000000000000000111100001111000011110000111100ULL),
+     TETROMINO_SHAPE(0b0000000000000000000000000000000000111100001111000011110000111100ULL)},  // O-TETRO
+    {TETROMINO_SHAPE(0b0000000000000000000000000000000011111100111111000011000000110000ULL),
+     TETROMINO_SHAPE(0b0000000000000000001100000011000000111100001111000011000000110000ULL),
+     TETROMINO_SHAPE(0b0000000000000000001100000011000011111100111111000000000000000000ULL),
+     TETROMINO_SHAPE(0b0000000000000000001100000011000011110000111100000011000000110000ULL)},  // T-TETRO
+    {TETROMINO_SHAPE(0b0000000000000000000000000000000011000000110000001111110011111100ULL),
+     TETROMINO_SHAPE(0b0000000000000000000011000000110000001100000011000011110000111100ULL),
+     TETROMINO_SHAPE(0b0000000000000000000000000000000011111100111111000000110000001100ULL),
+     TETROMINO_SHAPE(0b0000000000000000001111000011110000110000001100000011000000110000ULL)},  // J-TETRO
+    {TETROMINO_SHAPE(0b0000000000000000000000000000000000000011000000110011111100111111ULL),
+     TETROMINO_SHAPE(0b0000000000000000001111000011110000001100000011000000110000001100ULL),
+     TETROMINO_SHAPE(0b0000000000000000000000000000000000111111001111110011000000110000ULL),
+     TETROMINO_SHAPE(0b0000000000000000001100000011000000110000001100000011110000111100ULL)},  // L-TETRO
+    {TETROMINO_SHAPE(0b0000000000000000000000000000000000111100001111001111000011110000ULL),
+     TETROMINO_SHAPE(0b0000000000000000110000001100000011110000111100000011000000110000ULL),
+     TETROMINO_SHAPE(0b0000000000000000000000000000000000111100001111001111000011110000ULL),
+     TETROMINO_SHAPE(0b0000000000000000110000001100000011110000111100000011000000110000ULL)},  // S-TETRO
+    {TETROMINO_SHAPE(0b0000000000000000000000000000000000111100001111000000111100001111ULL),
+     TETROMINO_SHAPE(0b0000000000000000000011000000110000111100001111000011000000110000ULL),
+     TETROMINO_SHAPE(0b0000000000000000000000000000000000111100001111000000111100001111ULL),
+     TETROMINO_SHAPE(0b0000000000000000000011000000110000111100001111000011000000110000ULL)}  // Z-TETRO
 };
 
 /**
@@ -58,6 +122,13 @@ Tetromino::Tetromino(TetrominoType type)
  */
 Tetromino::~Tetromino() {}
 
+/**
+ * @brief Retrieves the type of the Tetromino.
+ *
+ * @return TetrominoType The type of the Tetromino.
+ */
+TetrominoType Tetromino::getType() const { return type; }
+
 /**
  * @brief Retrieves the current rotation of the Tetromino.
  *
@@ -111,35 +182,48 @@ void Tetromino::setOffset(uint8_t x, uint8_t y) {
 }
 
 /**
- * @brief Retrieves the display color for a specific Tetromino type.
+ * @brief Retrieves the palette color for a specific Tetromino type.
  *
- * Returns the RGB color associated with the given Tetromino type. These colors
- * are predefined and correspond to the visual appearance of the Tetrominos.
+ * Returns the logical color associated with the given Tetromino type. Empty
+ * cells (NO_TETRO) are black.
  *
  * @param type The Tetromino type for which the color is requested.
- * @return uint16_t The RGB color associated with the specified Tetromino type.
+ * @return Colors The palette color associated with the Tetromino type.
  */
-uint16_t Tetromino::getColor(TetrominoType type) {
+Colors Tetromino::getColorIndex(TetrominoType type) {
   switch (type) {
-    case NO_TETRO:
-      return Display::getColor(BLACK);
     case I_TETRO:
-      return Display::getColor(CYAN);
+      return CYAN;
     case O_TETRO:
-      return Display::getColor(YELLOW);
+      return YELLOW;
     case T_TETRO:
-      return Display::getColor(MAGENTA);
+      return MAGENTA;
     case J_TETRO:
-      return Display::getColor(BLUE);
+      return BLUE;
     case L_TETRO:
-      return Display::getColor(ORANGE);
+      return ORANGE;
     case S_TETRO:
-      return Display::getColor(GREEN);
+      return GREEN;
     case Z_TETRO:
-      return Display::getColor(RED);
+      return RED;
+    default:
+      return BLACK;
   }
 }
 
+/**
+ * @brief Retrieves the display color for a specific Tetromino type.
+ *
+ * Returns the RGB color associated with the given Tetromino type. These colors
+ * are predefined and correspond to the visual appearance of the Tetrominos.
+ *
+ * @param type The Tetromino type for which the color is requested.
+ * @return uint16_t The RGB color associated with the specified Tetromino type.
+ */
+uint16_t Tetromino::getColor(TetrominoType type) {
+  return Display::getColor(getColorIndex(type));
+}
+
 /**
  * @brief Sets the color of the Tetromino.
  *
@@ -151,49 +235,53 @@ uint16_t Tetromino::getColor(TetrominoType type) {
 void Tetromino::setColor(uint16_t newColor) { color = newColor; }
 
 /**
- * @brief Reads a 64-bit word from program memory (PROGMEM).
+ * @brief Retrieves the shape of a Tetromino type in a given rotation.
  *
- * Retrieves bit patterns for a Tetromino from flash memory, ensuring the data
- * is accessed correctly for drawing or collision checking.
+ * Copies the cell mask and its bounding box from flash memory in a single
+ * read.
  *
- * @param ptr Pointer to the 64-bit word in program memory.
- * @return uint64_t The retrieved bit pattern.
+ * @param type The Tetromino type.
+ * @param rotation The rotation index (0-3).
+ * @return TetrominoShape The shape of the Tetromino.
  */
-uint64_t pgm_read_qword(const void* ptr) {
-  uint64_t qword = 0;
-
-  for (uint8_t row = 0; row < 8; row++) {
-    uint8_t rowBits = pgm_read_byte((const uint8_t*)ptr + row);
-
-    // Reverse the bits for proper alignment
-    rowBits = (rowBits & 0xF0) >> 4 | (rowBits & 0x0F) << 4;
-    rowBits = (rowBits & 0xCC) >> 2 | (rowBits & 0x33) << 2;
-    rowBits = (rowBits & 0xAA) >> 1 | (rowBits & 0x55) << 1;
+TetrominoShape Tetromino::getShape(TetrominoType type, uint8_t rotation) {
+  TetrominoShape shape;
+  memcpy_P(&shape, &(TETROMINOES[type - 1][rotation]), sizeof(shape));
+  return shape;
+}
 
-    qword |= ((uint64_t)rowBits << ((7 - row) * 8));
+/**
+ * @brief Fills every cell of the Tetromino with a color.
+ *
+ * Each set bit of the cell mask is drawn as a block of BOARD_SCALE x
+ * BOARD_SCALE pixels.
+ *
+ * @param offsetX The X-coordinate offset for drawing.
+ * @param offsetY The Y-coordinate offset for drawing.
+ * @param fillColor The color to fill the cells with.
+ */
+void Tetromino::fillCells(uint8_t offsetX, uint8_t offsetY,
+                          uint16_t fillColor) {
+  uint16_t mask = getShape(type, rotation).mask;
+  for (uint8_t cell = 0; mask != 0; cell++, mask >>= 1) {
+    if (mask & 1) {
+      matrix.fillRect(offsetX + (cell % 4) * BOARD_SCALE,
+                      offsetY + (cell / 4) * BOARD_SCALE, BOARD_SCALE,
+                      BOARD_SCALE, fillColor);
+    }
   }
-
-  return qword;
 }
 
 /**
  * @brief Draws the Tetromino on the display.
  *
- * Iterates through the bit pattern of the Tetromino and renders each set bit
- * as a colored pixel on the display.
+ * Renders every occupied cell of the Tetromino in its color.
  *
  * @param offsetX The X-coordinate offset for drawing.
  * @param offsetY The Y-coordinate offset for drawing.
  */
 void Tetromino::draw(uint8_t offsetX, uint8_t offsetY) {
-  uint64_t shape = pgm_read_qword(&(TETROMINOES[type - 1][rotation]));
-  for (uint8_t row = 0; row < 8; row++) {
-    for (uint8_t col = 0; col < 8; col++) {
-      if (shape & (1ULL << (row * 8 + col))) {
-        matrix.drawPixel(offsetX + col, offsetY + row, color);
-      }
-    }
-  }
+  fillCells(offsetX, offsetY, color);
 }
 
 /**
@@ -206,73 +294,5 @@ void Tetromino::draw(uint8_t offsetX, uint8_t offsetY) {
  * @param offsetY The Y-coordinate offset for clearing.
  */
 void Tetromino::clear(uint8_t offsetX, uint8_t offsetY) {
-  uint64_t shape = pgm_read_qword(&(TETROMINOES[type - 1][rotation]));
-  for (uint8_t row = 0; row < 8; row++) {
-    for (uint8_t col = 0; col < 8; col++) {
-      if (shape & (1ULL << (row * 8 + col))) {
-        matrix.drawPixel(offsetX + col, offsetY + row,
-                         Display::getColor(BLACK));
-      }
-    }
-  }
+  fillCells(offsetX, offsetY, Display::getColor(BLACK));
 }
-
-/**
- * @brief Moves the Tetromino to the left on the game board.
- *
- * This method checks for collisions on the board before moving the Tetromino
- * two units to the left. If a collision is detected, the movement is blocked.
- *
- * @param board Reference to the game board.
- * @return true if the movement was successful, false if it was blocked.
- */
-bool Tetromino::moveLeft(Board& board) {
-  if (board.checkCollision(*this, offsetX - 2, offsetY, rotation)) return false;
-  offsetX -= 2;
-  return true;
-}
-
-/**
- * @brief Moves the Tetromino to the right on the game board.
- *
- * This method checks for collisions on the board before moving the Tetromino
- * two units to the right. If a collision is detected, the movement is blocked.
- *
- * @param board Reference to the game board.
- * @return true if the movement was successful, false if it was blocked.
- */
-bool Tetromino::moveRight(Board& board) {
-  if (board.checkCollision(*this, offsetX + 2, offsetY, rotation)) return false;
-  offsetX += 2;
-  return true;
-}
-/**
- * @brief Moves the Tetromino down on the game board.
- *
- * This method checks for collisions on the board before moving the Tetromino
- * two units downward. If a collision is detected, the movement is blocked.
- *
- * @param board Reference to the game board.
- * @return true if the movement was successful, false if it was blocked.
- */
-bool Tetromino::moveDown(Board& board) {
-  if (board.checkCollision(*this, offsetX, offsetY + 2, rotation)) return false;
-  offsetY += 2;
-  return true;
-}
-
-/**
- * @brief Rotates the Tetromino to its next orientation.
- *
- * This method checks for collisions on the board before rotating the Tetromino
- * to its next orientation. If a collision is detected, the rotation is blocked.
- *
- * @param board Reference to the game board.
- * @return true if the rotation was successful, false if it was blocked.
- */
-bool Tetromino::rotate(Board& board) {
-  byte nextRotation = (rotation + 1) % 4;
-  if (board.checkCollision(*this, offsetX, offsetY, nextRotation)) return false;
-  rotation = nextRotation;
-  return true;
-}
\ No newline at end of file
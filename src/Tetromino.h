@@ -5,15 +5,32 @@
 
 #include "Display.h"
 
-class Board;
+template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+          uint8_t OffsetY, typename Packing>
+class BasicBoard;
 
 /**
- * @brief Declaration of Tetromino bit patterns as an external constant.
+ * @brief Cell-resolution shape of a Tetromino in one rotation.
  *
- * These patterns define the shapes of each Tetromino in all four possible
- * rotations.
+ * Each cell of the 4x4 grid covers a 2x2 pixel block on the display. Bit
+ * (row * 4 + col) of the mask is set for every occupied cell. The bounding box
+ * of the occupied cells is precomputed so callers can skip empty rows and
+ * check the board walls without scanning the mask.
  */
-extern const uint64_t TETROMINOES[8][4] PROGMEM;
+struct TetrominoShape {
+  uint16_t mask;       ///< Occupied cells, bit (row * 4 + col).
+  uint8_t left : 2;    ///< First occupied column.
+  uint8_t right : 2;   ///< Last occupied column.
+  uint8_t top : 2;     ///< First occupied row.
+  uint8_t bottom : 2;  ///< Last occupied row.
+};
+
+/**
+ * @brief Declaration of Tetromino shapes as an external constant.
+ *
+ * These shapes define each Tetromino in all four possible rotations.
+ */
+extern const TetrominoShape TETROMINOES[7][4] PROGMEM;
 
 /**
  * @brief Enumeration of Tetromino types.
@@ -45,6 +62,15 @@ class Tetromino {
   uint8_t offsetX;     ///< The X-coordinate offset of the Tetromino.
   uint8_t offsetY;     ///< The Y-coordinate offset of the Tetromino.
 
+  /**
+   * @brief Fills every cell of the Tetromino with a color.
+   *
+   * @param offsetX The X-coordinate offset.
+   * @param offsetY The Y-coordinate offset.
+   * @param fillColor The color to fill the cells with.
+   */
+  void fillCells(uint8_t offsetX, uint8_t offsetY, uint16_t fillColor);
+
  public:
   /**
    * @brief Constructor for the Tetromino class.
@@ -58,6 +84,13 @@ class Tetromino {
    */
   ~Tetromino();
 
+  /**
+   * @brief Retrieves the type of the Tetromino.
+   *
+   * @return TetrominoType The type of the Tetromino.
+   */
+  TetrominoType getType() const;
+
   /**
    * @brief Retrieves the current rotation of the Tetromino.
    *
@@ -109,6 +142,23 @@ class Tetromino {
    */
   void setOffset(uint8_t x, uint8_t y);
 
+  /**
+   * @brief Retrieves the shape of a Tetromino type in a given rotation.
+   *
+   * @param type The Tetromino type.
+   * @param rotation The rotation index (0-3).
+   * @return TetrominoShape The shape read from program memory.
+   */
+  static TetrominoShape getShape(TetrominoType type, uint8_t rotation);
+
+  /**
+   * @brief Retrieves the palette color for a specific Tetromino type.
+   *
+   * @param type The Tetromino type.
+   * @return Colors The palette color of the Tetromino type.
+   */
+  static Colors getColorIndex(TetrominoType type);
+
   /**
    * @brief Retrieves the color for a specific Tetromino type.
    *
@@ -149,10 +199,12 @@ class Tetromino {
    * Checks for collisions before moving. If a collision occurs, the movement
    * is blocked.
    *
+   * @tparam BoardType The board geometry the Tetromino moves on.
    * @param board Reference to the game board.
    * @return true if the movement was successful, false otherwise.
    */
-  bool moveLeft(Board& board);
+  template <typename BoardType>
+  bool moveLeft(BoardType& board);
 
   /**
    * @brief Moves the Tetromino to the right.
@@ -160,10 +212,12 @@ class Tetromino {
    * Checks for collisions before moving. If a collision occurs, the movement
    * is blocked.
    *
+   * @tparam BoardType The board geometry the Tetromino moves on.
    * @param board Reference to the game board.
    * @return true if the movement was successful, false otherwise.
    */
-  bool moveRight(Board& board);
+  template <typename BoardType>
+  bool moveRight(BoardType& board);
 
   /**
    * @brief Moves the Tetromino downward.
@@ -171,10 +225,12 @@ class Tetromino {
    * Checks for collisions before moving. If a collision occurs, the movement
    * is blocked.
    *
+   * @tparam BoardType The board geometry the Tetromino moves on.
    * @param board Reference to the game board.
    * @return true if the movement was successful, false otherwise.
    */
-  bool moveDown(Board& board);
+  template <typename BoardType>
+  bool moveDown(BoardType& board);
 
   /**
    * @brief Rotates the Tetromino.
@@ -182,23 +238,95 @@ class Tetromino {
    * Checks for collisions before rotating. If a collision occurs, the rotation
    * is blocked.
    *
+   * @tparam BoardType The board geometry the Tetromino moves on.
    * @param board Reference to the game board.
    * @return true if the rotation was successful, false otherwise.
    */
-  bool rotate(Board& board);
+  template <typename BoardType>
+  bool rotate(BoardType& board);
 
-  friend class Board;  ///< Allows the Board class to access private members.
+  /// Allows the board classes to access private members.
+  template <uint8_t Width, uint8_t Height, uint8_t Scale, uint8_t OffsetX,
+            uint8_t OffsetY, typename Packing>
+  friend class BasicBoard;
 };
 
 /**
- * @brief Reads a 64-bit word from program memory (PROGMEM).
+ * @brief Moves the Tetromino to the left on the game board.
+ *
+ * This method checks for collisions on the board before moving the Tetromino
+ * one board cell to the left. If a collision is detected, the movement is
+ * blocked.
+ *
+ * @tparam BoardType The board geometry the Tetromino moves on.
+ * @param board Reference to the game board.
+ * @return true if the movement was successful, false if it was blocked.
+ */
+template <typename BoardType>
+bool Tetromino::moveLeft(BoardType& board) {
+  if (board.checkCollision(*this, offsetX - BoardType::SCALE, offsetY,
+                           rotation))
+    return false;
+  offsetX -= BoardType::SCALE;
+  return true;
+}
+
+/**
+ * @brief Moves the Tetromino to the right on the game board.
+ *
+ * This method checks for collisions on the board before moving the Tetromino
+ * one board cell to the right. If a collision is detected, the movement is
+ * blocked.
+ *
+ * @tparam BoardType The board geometry the Tetromino moves on.
+ * @param board Reference to the game board.
+ * @return true if the movement was successful, false if it was blocked.
+ */
+template <typename BoardType>
+bool Tetromino::moveRight(BoardType& board) {
+  if (board.checkCollision(*this, offsetX + BoardType::SCALE, offsetY,
+                           rotation))
+    return false;
+  offsetX += BoardType::SCALE;
+  return true;
+}
+
+/**
+ * @brief Moves the Tetromino down on the game board.
+ *
+ * This method checks for collisions on the board before moving the Tetromino
+ * one board cell downward. If a collision is detected, the movement is
+ * blocked.
+ *
+ * @tparam BoardType The board geometry the Tetromino moves on.
+ * @param board Reference to the game board.
+ * @return true if the movement was successful, false if it was blocked.
+ */
+template <typename BoardType>
+bool Tetromino::moveDown(BoardType& board) {
+  if (board.checkCollision(*this, offsetX, offsetY + BoardType::SCALE,
+                           rotation))
+    return false;
+  offsetY += BoardType::SCALE;
+  return true;
+}
+
+/**
+ * @brief Rotates the Tetromino to its next orientation.
  *
- * This function retrieves data stored in flash memory for use with Tetromino
- * shapes.
+ * This method checks for collisions on the board before rotating the Tetromino
+ * to its next orientation. If a collision is detected, the rotation is blocked.
  *
- * @param ptr Pointer to the data in program memory.
- * @return uint64_t The 64-bit value read from memory.
+ * @tparam BoardType The board geometry the Tetromino moves on.
+ * @param board Reference to the game board.
+ * @return true if the rotation was successful, false if it was blocked.
  */
-uint64_t pgm_read_qword(const void* ptr);
+template <typename BoardType>
+bool Tetromino::rotate(BoardType& board) {
+  byte nextRotation = (rotation + 1) % 4;
+  if (board.checkCollision(*this, offsetX, offsetY, nextRotation)) return false;
+  rotation = nextRotation;
+  return true;
+}
 
 #endif
\ No newline at end of file